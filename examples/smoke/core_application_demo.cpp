@@ -20,6 +20,7 @@ public:
     explicit SecondsElapsedEvent(int seconds) : value(seconds) {}
 
     std::type_index type() const override { return typeid(SecondsElapsedEvent); }
+    IMGUIX_EVENT_TYPE_ID(SecondsElapsedEvent)
     const char* name() const override { return "SecondsElapsedEvent"; }
     std::unique_ptr<Event> clone() const override {return std::make_unique<SecondsElapsedEvent>(*this);}
 };
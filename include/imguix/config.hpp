@@ -11,6 +11,8 @@
 #include "config/icons.hpp"
 #include "config/colors.hpp"
 #include "config/options.hpp"
+#include "config/frame.hpp"
+#include "config/profiler.hpp"
 #include "config/sizing.hpp"
 #include "config/theme_config.hpp"
 #include "config/notifications.hpp"
@@ -30,4 +30,57 @@
 #   define IMGUIX_FONTS_FALLBACK_ICONS_BASENAME u8"forkawesome-webfont.ttf"
 #endif
 
+#ifndef IMGUIX_FONTS_SHARED_ATLAS
+/// \brief Share one font atlas between windows with identical font configuration.
+/// \details Default of FontManager::setSharedAtlas(). GLFW and SDL2 windows always
+///          create GL contexts sharing objects with the previous window: the
+///          shared atlas has one texture that every window must see, and the
+///          mode can also be enabled per window at run time.
+#   define IMGUIX_FONTS_SHARED_ATLAS 0
+#endif
+
+#ifndef IMGUIX_FONTS_DISK_CACHE
+/// \brief Store baked font atlases on disk and restore them on the next start.
+/// \details Default of FontManager::setDiskCache(). Only static atlases
+///          (ImGui < 1.92) are cached; ImGui 1.92+ bakes glyphs on demand.
+///          Off by default; enable it for pre-1.92 builds with large ranges.
+#   define IMGUIX_FONTS_DISK_CACHE 0
+#endif
+
+#ifndef IMGUIX_FONTS_DISK_CACHE_DIR
+/// \brief Directory of baked atlas files (next to the config directory).
+#   define IMGUIX_FONTS_DISK_CACHE_DIR u8"data/cache/fonts"
+#endif
+
+#ifndef IMGUIX_FONTS_DYNAMIC_GLYPHS
+/// \brief Bake glyphs when text first uses them instead of preloading ranges.
+/// \details Default of FontManager::setDynamicGlyphs(). Requires ImGui 1.92+;
+///          older versions keep baking the configured ranges.
+#   define IMGUIX_FONTS_DYNAMIC_GLYPHS 0
+#endif
+
+#ifndef IMGUIX_FONTS_DYNAMIC_ATLAS_BUDGET
+/// \brief Atlas texture size in bytes above which unused bakes are evicted.
+/// \details Default of FontManager::setAtlasBudget(). Applies to every atlas with
+///          ImGui 1.92+, with or without dynamic glyphs; 0 disables trimming.
+#   define IMGUIX_FONTS_DYNAMIC_ATLAS_BUDGET (16u * 1024u * 1024u)
+#endif
+
+#ifndef IMGUIX_FONTS_DYNAMIC_TRIM_INTERVAL
+/// \brief Frames to wait after an eviction before checking the budget again.
+#   define IMGUIX_FONTS_DYNAMIC_TRIM_INTERVAL 120
+#endif
+
+#ifndef IMGUIX_FONTS_BACKGROUND_REBUILD
+/// \brief Rasterize rebuilt font atlases on a worker thread.
+/// \details Default of FontManager::setBackgroundRebuild(). The old atlas keeps
+///          rendering until the new one is swapped in at a frame boundary.
+///          Applies to private static atlases (ImGui < 1.92) only.
+/// \warning The worker allocates through ImGui::MemAlloc(), which updates the
+///          allocation counters and debug hook of GImGui without locking. Enabling
+///          this requires a thread-local GImGui (`#define GImGui` in imconfig.h);
+///          FontManager.hpp refuses to compile otherwise.
+#   define IMGUIX_FONTS_BACKGROUND_REBUILD 0
+#endif
+
 #endif // _IMGUIX_CONFIG_FONTS_HPP_INCLUDED
@@ -0,0 +1,22 @@
+#ifndef _IMGUIX_CONFIG_FRAME_HPP_INCLUDED
+#define _IMGUIX_CONFIG_FRAME_HPP_INCLUDED
+
+/// \file frame.hpp
+/// \brief Frame pacing configuration values.
+
+#ifndef IMGUIX_DEFAULT_TARGET_FPS
+/// \brief Default frame rate limit of a window; 0 disables the limit.
+#   define IMGUIX_DEFAULT_TARGET_FPS 60
+#endif
+
+#ifndef IMGUIX_IDLE_WAIT_TIMEOUT_MS
+/// \brief Longest time the main loop blocks waiting for input when all windows are idle.
+#   define IMGUIX_IDLE_WAIT_TIMEOUT_MS 250
+#endif
+
+#ifndef IMGUIX_REDRAW_FRAMES
+/// \brief Frames rendered after input or a redraw request in on-demand mode.
+#   define IMGUIX_REDRAW_FRAMES 3
+#endif
+
+#endif // _IMGUIX_CONFIG_FRAME_HPP_INCLUDED
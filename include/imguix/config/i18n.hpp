@@ -20,6 +20,25 @@
 #   define IMGUIX_I18N_PLURALS_FILENAME u8"plurals.json"
 #endif
 
+#ifndef IMGUIX_I18N_BINARY_CATALOG
+/// \brief Compile each language into `<lang>.i18n.bin` under IMGUIX_I18N_CACHE_DIR
+///        and memory-map it on later runs when nonzero; 0 keeps tables in memory only.
+/// \details Off by default. Catalogs shipped next to the JSON sources (see
+///          LangCatalog::compile()) are mapped either way.
+#   define IMGUIX_I18N_BINARY_CATALOG 0
+#endif
+
+#ifndef IMGUIX_I18N_CACHE_DIR
+/// \brief Directory of compiled catalogs written at run time.
+#   define IMGUIX_I18N_CACHE_DIR u8"data/cache/i18n"
+#endif
+
+#ifndef IMGUIX_I18N_PRELOAD_LANGUAGES
+/// \brief Comma-separated languages the default LangCatalog loads in parallel
+///        background threads at startup, e.g. u8"ru,de". Empty disables warming.
+#   define IMGUIX_I18N_PRELOAD_LANGUAGES u8""
+#endif
+
 #ifndef IMGUIX_RESOLVE_PATHS_REL_TO_EXE
 /// \brief Resolve resource paths relative to the executable when nonzero.
 #   define IMGUIX_RESOLVE_PATHS_REL_TO_EXE 1
@@ -9,4 +9,20 @@
 #   define IMGUIX_OPTIONS_SAVE_DELAY_SEC 0.5
 #endif
 
+#ifndef IMGUIX_OPTIONS_FSYNC
+/// \brief Default fsync policy of OptionsStore: 0 never, 1 on flush, 2 every save.
+#   define IMGUIX_OPTIONS_FSYNC 1
+#endif
+
+#ifndef IMGUIX_OPTIONS_JOURNAL
+/// \brief Default journal mode of OptionsStore: 1 appends changed keys to
+///        `<file>.journal` instead of rewriting the whole file on every save.
+#   define IMGUIX_OPTIONS_JOURNAL 0
+#endif
+
+#ifndef IMGUIX_OPTIONS_JOURNAL_MAX_BYTES
+/// \brief Journal size in bytes after which the next save compacts it into a snapshot.
+#   define IMGUIX_OPTIONS_JOURNAL_MAX_BYTES 262144
+#endif
+
 #endif // _IMGUIX_CONFIG_OPTIONS_HPP_INCLUDED
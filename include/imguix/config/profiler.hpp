@@ -0,0 +1,17 @@
+#ifndef _IMGUIX_CONFIG_PROFILER_HPP_INCLUDED
+#define _IMGUIX_CONFIG_PROFILER_HPP_INCLUDED
+
+/// \file profiler.hpp
+/// \brief Frame profiler configuration values.
+
+#ifndef IMGUIX_ENABLE_PROFILER
+/// \brief Compile IMGUIX_PROFILE_* instrumentation in when nonzero.
+#   define IMGUIX_ENABLE_PROFILER 0
+#endif
+
+#ifndef IMGUIX_PROFILER_HISTORY
+/// \brief Number of frames kept by the frame profiler.
+#   define IMGUIX_PROFILER_HISTORY 240
+#endif
+
+#endif // _IMGUIX_CONFIG_PROFILER_HPP_INCLUDED
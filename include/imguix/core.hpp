@@ -38,6 +38,9 @@
 
 #include <imgui.h>
 
+// --- Profiling ---
+#include "core/profiler/FrameProfiler.hpp"        ///< Per-stage frame timings (IMGUIX_PROFILE_*)
+
 // --- Event and PubSub system ---
 #include "core/pubsub.hpp"                         ///< EventBus, Event, EventMediator
 #include "core/events.hpp"                         ///< Common built-in events
@@ -66,6 +69,7 @@
 #include "core/controller/Controller.hpp"          ///< Base interface for controllers
 #include "core/model/Model.hpp"                    ///< Base interface for models
 #include "core/model/FeatureModel.hpp"             ///< Base class for feature models
+#include "core/model/ModelScheduler.hpp"           ///< Worker-thread execution of models
 
 // --- Windowing system ---
 #include "core/window/WindowInstance.hpp"          ///< Abstract window interface
@@ -52,6 +52,14 @@ namespace ImGuiX {
         /// \return Reference to the name string.
         const std::string& name() const override;
 
+        /// \brief Enable worker-thread execution of models.
+        /// \param count Number of worker threads; 0 (default) runs all models on the UI thread.
+        /// \note Models opt in with Model::setExecution(). Call before run() or from the loop thread.
+        void setModelWorkerCount(std::size_t count);
+
+        /// \brief Returns per-model execution-time statistics in creation order.
+        std::vector<ModelStats> modelStats() const;
+
     protected:
         /// \brief Create window via factory.
         /// \param factory Factory producing window instance.
@@ -67,6 +75,7 @@ namespace ImGuiX {
         Pubsub::EventBus m_event_bus;                 ///< Global event bus.
         ResourceRegistry m_registry;                   ///< Shared resource registry.
         WindowManager m_window_manager;                ///< Manages all windows.
+        ResourceHandle<OptionsStore> m_options;        ///< Cached OptionsStore access for the loop.
         std::thread m_main_thread;                     ///< Thread running the main loop when async.
         std::atomic<bool> m_is_closing{false};         ///< Indicates shutdown in progress.
         std::atomic<bool> m_is_ini_once{false};        ///< Ensures imgui ini is saved only once.
@@ -78,6 +87,7 @@ namespace ImGuiX {
         std::string m_app_name = u8"ImGuiX Application"; ///< Application name string.
         std::vector<std::unique_ptr<Model>> m_models;  ///< Owned model objects.
         std::vector<Model*> m_pending_models;          ///< Models waiting for initialization.
+        ModelScheduler m_model_scheduler;              ///< Runs Model::process() each frame.
 
         /// \brief Main application loop.
         void mainLoop();
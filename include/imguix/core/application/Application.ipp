@@ -29,7 +29,8 @@ namespace ImGuiX {
 
     Application::Application()
         : m_event_bus(), m_registry(),
-          m_window_manager(*static_cast<ApplicationContext*>(this)) {
+          m_window_manager(*static_cast<ApplicationContext*>(this)),
+          m_options(m_registry.handle<OptionsStore>()) {
         initFilesystem();
         if (!m_is_fs_ready.load()) {
             std::unique_lock<std::mutex> lock(m_fs_ready_mutex);
@@ -111,6 +112,14 @@ namespace ImGuiX {
         return m_app_name;
     }
 
+    void Application::setModelWorkerCount(std::size_t count) {
+        m_model_scheduler.setWorkerCount(count);
+    }
+
+    std::vector<ModelStats> Application::modelStats() const {
+        return m_model_scheduler.stats();
+    }
+
     bool Application::allWindowsClosed() const {
         return m_window_manager.allWindowsClosed();
     }
@@ -137,15 +146,16 @@ namespace ImGuiX {
     }
 
     bool Application::loopIteration() {
+        IMGUIX_PROFILE_FRAME_BEGIN();
         // Update window lifecycles before rendering the frame
-        m_window_manager.prepareFrame();
-        initializePendingModels();
-        ImGuiX::Pubsub::SyncNotifier notifier{m_event_bus};
+        {
+            IMGUIX_PROFILE_SCOPE("prepareFrame");
+            m_window_manager.prepareFrame();
+            initializePendingModels();
+        }
         if (allWindowsClosed()) {
             m_event_bus.process();
-            for (auto& model : m_models) {
-                model->process(notifier);
-            }
+            m_model_scheduler.run(m_models, m_event_bus);
             m_event_bus.process();
 #ifdef __EMSCRIPTEN__
             endLoop();
@@ -155,22 +165,34 @@ namespace ImGuiX {
         }
 
         m_window_manager.initIniAll();
-        for (auto& model : m_models) {
-            model->process(notifier);
+        {
+            IMGUIX_PROFILE_SCOPE("models");
+            m_model_scheduler.run(m_models, m_event_bus);
+        }
+        {
+            IMGUIX_PROFILE_SCOPE("eventBus");
+            if (m_event_bus.process() > 0) {
+                // Only windows that opted in; other handlers call requestRedraw().
+                m_window_manager.requestRedrawOnEvents();
+            }
         }
-        m_event_bus.process();
         
         m_window_manager.processFrame();
 
-        m_registry.getResource<OptionsStore>().update();
+        {
+            IMGUIX_PROFILE_SCOPE("options");
+            m_options->update();
+        }
 
+        IMGUIX_PROFILE_FRAME_END();
         return true;
     }
 
     void Application::endLoop() {
         m_is_closing = true;
         m_window_manager.shutdown();
-        m_registry.getResource<OptionsStore>().saveNow();
+        // Barrier: queued option saves reach the disk before the loop exits.
+        m_options->flush();
     }
 
     void Application::mainLoop() {
@@ -6,6 +6,8 @@
 /// \brief Base class for window-attached logic/rendering controllers.
 /// \note Hosts lightweight feature models via FeatureAccessMixin.
 
+#include <imguix/themes/theme_ids.hpp>
+
 namespace ImGuiX {
 
     /// \brief Base class for controllers that attach to a window.
@@ -105,8 +107,22 @@ namespace ImGuiX {
             themeManager().setTheme(std::move(id)); 
         }
 
+        /// \brief Cached handle of the stored theme identifier.
+        /// \param default_id Value returned while no theme is stored.
+        /// \return Handle of IMGUIX_THEME_STORAGE_KEY in options().
+        /// \note Rebound only when \p default_id changes; used by Widgets::ThemePicker.
+        OptionKey<std::string>& themeKey(const char* default_id) {
+            if (!m_theme_key || m_theme_key.defaultValue() != default_id) {
+                m_theme_key = options().key<std::string>(IMGUIX_THEME_STORAGE_KEY, default_id);
+            }
+            return m_theme_key;
+        }
+
     protected:
         WindowInterface& m_window; ///< Controlled window instance.
+
+    private:
+        OptionKey<std::string> m_theme_key; ///< Cached by themeKey().
     };
 
 } // namespace ImGuiX
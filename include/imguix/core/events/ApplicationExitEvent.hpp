@@ -18,6 +18,11 @@ namespace ImGuiX::Events {
             return typeid(ApplicationExitEvent);
         }
 
+        /// \copydoc Pubsub::Event::typeId
+        Pubsub::EventTypeId typeId() const override {
+            return Pubsub::eventTypeId<ApplicationExitEvent>();
+        }
+
         /// \copydoc Pubsub::Event::name
         const char* name() const override {
             return u8"ApplicationExitEvent";
@@ -27,6 +32,11 @@ namespace ImGuiX::Events {
         std::unique_ptr<Event> clone() const override {
             return std::make_unique<ApplicationExitEvent>(*this);
         }
+
+        /// \copydoc Pubsub::Event::copyTo
+        bool copyTo(Pubsub::Event& target) const override {
+            return Pubsub::detail::assignEvent<ApplicationExitEvent>(target, *this);
+        }
     };
 
 } // namespace ImGuiX::Events
@@ -44,6 +44,11 @@ namespace ImGuiX::Events {
             return typeid(LangChangeEvent);
         }
 
+        /// \copydoc Pubsub::Event::typeId
+        Pubsub::EventTypeId typeId() const override {
+            return Pubsub::eventTypeId<LangChangeEvent>();
+        }
+
         /// \copydoc Pubsub::Event::name
         const char* name() const override {
             return u8"LangChangeEvent";
@@ -53,6 +58,11 @@ namespace ImGuiX::Events {
         std::unique_ptr<Event> clone() const override {
             return std::make_unique<LangChangeEvent>(*this);
         }
+
+        /// \copydoc Pubsub::Event::copyTo
+        bool copyTo(Pubsub::Event& target) const override {
+            return Pubsub::detail::assignEvent<LangChangeEvent>(target, *this);
+        }
     };
 
 } // namespace ImGuiX::Events
@@ -69,6 +69,9 @@ namespace ImGuiX::Events {
         /// \copydoc Pubsub::Event::type
         std::type_index type() const override { return typeid(LogEvent); }
 
+        /// \copydoc Pubsub::Event::typeId
+        Pubsub::EventTypeId typeId() const override { return Pubsub::eventTypeId<LogEvent>(); }
+
         /// \copydoc Pubsub::Event::name
         const char *name() const override { return u8"LogEvent"; }
 
@@ -82,6 +85,11 @@ namespace ImGuiX::Events {
                 function
             );
         }
+
+        /// \copydoc Pubsub::Event::copyTo
+        bool copyTo(Pubsub::Event& target) const override {
+            return Pubsub::detail::assignEvent<LogEvent>(target, *this);
+        }
     };
 
 } // namespace ImGuiX::Events
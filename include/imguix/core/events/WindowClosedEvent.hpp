@@ -24,6 +24,11 @@ namespace ImGuiX::Events {
             return typeid(WindowClosedEvent);
         }
 
+        /// \copydoc Pubsub::Event::typeId
+        Pubsub::EventTypeId typeId() const override {
+            return Pubsub::eventTypeId<WindowClosedEvent>();
+        }
+
         /// \copydoc Pubsub::Event::name
         const char* name() const override {
             return u8"WindowClosedEvent";
@@ -33,6 +38,11 @@ namespace ImGuiX::Events {
         std::unique_ptr<Event> clone() const override {
             return std::make_unique<WindowClosedEvent>(*this);
         }
+
+        /// \copydoc Pubsub::Event::copyTo
+        bool copyTo(Pubsub::Event& target) const override {
+            return Pubsub::detail::assignEvent<WindowClosedEvent>(target, *this);
+        }
     };
 
 } // namespace ImGuiX::Events
@@ -0,0 +1,117 @@
+#pragma once
+#ifndef _IMGUIX_FONTS_ATLAS_FILE_CACHE_HPP_INCLUDED
+#define _IMGUIX_FONTS_ATLAS_FILE_CACHE_HPP_INCLUDED
+
+/// \file AtlasFileCache.hpp
+/// \brief Baked font atlases stored on disk between runs.
+///
+/// FontManager hashes everything that affects the baked atlas (font file
+/// size/mtime, sizes, DPI, UI scale, glyph ranges, FreeType flags, ImGui
+/// version) and stores the RGBA pixels together with the glyph tables as
+/// `<IMGUIX_FONTS_DISK_CACHE_DIR>/<hash>.atlas`. The next start restores the
+/// atlas from that file and skips reading TTFs and rasterizing glyphs.
+///
+/// Notes:
+/// - Only static atlases (ImGui < 1.92) are cached. ImGui 1.92+ bakes glyphs on
+///   demand, so there is nothing to restore and load()/save() return false.
+/// - Restored fonts have no TTF data: glyphs outside the cached ranges stay
+///   unavailable until the next rebuild with a different key.
+/// - Files are written atomically (temp file + rename); a stale or foreign file
+///   is rejected by its header and rebuilt.
+
+#include <imgui.h>
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+#include "font_types.hpp"
+
+namespace ImGuiX::Fonts {
+
+    /// \class AtlasFileCache
+    /// \brief Save and restore baked atlases.
+    class AtlasFileCache {
+    public:
+        /// \brief True if this ImGui version has static atlases that can be cached.
+        static constexpr bool isSupported() noexcept { return IMGUI_VERSION_NUM < 19200; }
+
+        /// \brief Path of the cache file of a configuration.
+        /// \param dir Cache directory.
+        /// \param key Configuration hash.
+        static std::filesystem::path pathFor(const std::filesystem::path& dir, std::uint64_t key);
+
+        /// \brief Store a built atlas.
+        /// \param path Cache file.
+        /// \param key Configuration hash written into the header.
+        /// \param atlas Built atlas; its RGBA pixels are taken with GetTexDataAsRGBA32().
+        /// \param fonts Role map of fonts inside \p atlas.
+        /// \return True if the file was written.
+        static bool save(
+                const std::filesystem::path& path,
+                std::uint64_t key,
+                ImFontAtlas& atlas,
+                const std::unordered_map<FontRole, ImFont*>& fonts
+            ) noexcept;
+
+        /// \brief Replace the contents of \p atlas with a cached bake.
+        /// \param path Cache file.
+        /// \param key Expected configuration hash.
+        /// \param atlas Atlas to fill; cleared first when the file is valid.
+        /// \param fonts Receives the role map of restored fonts.
+        /// \return True if the atlas is ready for the backend texture upload.
+        static bool load(
+                const std::filesystem::path& path,
+                std::uint64_t key,
+                ImFontAtlas& atlas,
+                std::unordered_map<FontRole, ImFont*>& fonts
+            );
+
+    private:
+        static constexpr std::uint32_t kMagic   = 0x41465849u; ///< "IXFA"
+        static constexpr std::uint32_t kVersion = 1;
+
+        /// \brief File header; followed by fonts, roles, UV lines and pixels.
+        struct Header {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t key;
+            std::uint32_t imgui_version; ///< IMGUI_VERSION_NUM of the writer.
+            std::uint32_t tex_width;
+            std::uint32_t tex_height;
+            std::uint32_t font_count;
+            std::uint32_t role_count;
+            std::uint32_t line_count;  ///< Number of TexUvLines entries.
+            std::int32_t  atlas_flags;
+            float uv_scale[2];
+            float uv_white_pixel[2];
+            std::uint32_t reserved;
+        };
+
+        /// \brief Metrics of one font; followed by Glyph[glyph_count].
+        struct FontRecord {
+            float size;
+            float ascent;
+            float descent;
+            std::uint32_t glyph_count;
+        };
+
+        struct Glyph {
+            std::uint32_t codepoint;
+            std::uint32_t flags; ///< Bit 0: visible, bit 1: colored.
+            float advance_x;
+            float x0, y0, x1, y1;
+            float u0, v0, u1, v1;
+        };
+
+        struct RoleRecord {
+            std::uint32_t role;
+            std::uint32_t font_index;
+        };
+    };
+
+} // namespace ImGuiX::Fonts
+
+#ifdef IMGUIX_HEADER_ONLY
+#   include "AtlasFileCache.ipp"
+#endif
+
+#endif // _IMGUIX_FONTS_ATLAS_FILE_CACHE_HPP_INCLUDED
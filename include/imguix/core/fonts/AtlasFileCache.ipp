@@ -0,0 +1,224 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <imguix/utils/atomic_write.hpp>
+#include <imguix/utils/mapped_file.hpp>
+
+namespace ImGuiX::Fonts {
+
+    inline std::filesystem::path AtlasFileCache::pathFor(const std::filesystem::path& dir, std::uint64_t key) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.atlas", static_cast<unsigned long long>(key));
+        return dir / name;
+    }
+
+#if IMGUI_VERSION_NUM < 19200
+
+    inline bool AtlasFileCache::save(
+            const std::filesystem::path& path,
+            std::uint64_t key,
+            ImFontAtlas& atlas,
+            const std::unordered_map<FontRole, ImFont*>& fonts
+        ) noexcept {
+        std::vector<unsigned char> out;
+        try {
+            unsigned char* pixels = nullptr;
+            int width = 0;
+            int height = 0;
+            atlas.GetTexDataAsRGBA32(&pixels, &width, &height);
+            if (!pixels || width <= 0 || height <= 0) return false;
+
+            auto put = [&out](const auto& v) {
+                const auto* p = reinterpret_cast<const unsigned char*>(&v);
+                out.insert(out.end(), p, p + sizeof(v));
+            };
+
+            Header h{};
+            h.magic = kMagic;
+            h.version = kVersion;
+            h.key = key;
+            h.imgui_version = IMGUI_VERSION_NUM;
+            h.tex_width = static_cast<std::uint32_t>(width);
+            h.tex_height = static_cast<std::uint32_t>(height);
+            h.font_count = static_cast<std::uint32_t>(atlas.Fonts.Size);
+            h.role_count = 0;
+            h.line_count = static_cast<std::uint32_t>(IM_ARRAYSIZE(atlas.TexUvLines));
+            h.atlas_flags = atlas.Flags;
+            h.uv_scale[0] = atlas.TexUvScale.x;
+            h.uv_scale[1] = atlas.TexUvScale.y;
+            h.uv_white_pixel[0] = atlas.TexUvWhitePixel.x;
+            h.uv_white_pixel[1] = atlas.TexUvWhitePixel.y;
+            for (const auto& kv : fonts) {
+                if (kv.second) ++h.role_count;
+            }
+            put(h);
+
+            for (const ImFont* font : atlas.Fonts) {
+                FontRecord rec{font->FontSize, font->Ascent, font->Descent,
+                               static_cast<std::uint32_t>(font->Glyphs.Size)};
+                put(rec);
+                for (const ImFontGlyph& g : font->Glyphs) {
+                    Glyph gr{};
+                    gr.codepoint = g.Codepoint;
+                    gr.flags = (g.Visible ? 1u : 0u) | (g.Colored ? 2u : 0u);
+                    gr.advance_x = g.AdvanceX;
+                    gr.x0 = g.X0; gr.y0 = g.Y0; gr.x1 = g.X1; gr.y1 = g.Y1;
+                    gr.u0 = g.U0; gr.v0 = g.V0; gr.u1 = g.U1; gr.v1 = g.V1;
+                    put(gr);
+                }
+            }
+
+            for (const auto& kv : fonts) {
+                if (!kv.second) continue;
+                int index = 0;
+                while (index < atlas.Fonts.Size && atlas.Fonts[index] != kv.second) ++index;
+                if (index == atlas.Fonts.Size) return false; // role points outside the atlas
+                put(RoleRecord{static_cast<std::uint32_t>(kv.first), static_cast<std::uint32_t>(index)});
+            }
+
+            for (const ImVec4& uv : atlas.TexUvLines) put(uv);
+
+            const std::size_t pixel_bytes = static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4u;
+            out.insert(out.end(), pixels, pixels + pixel_bytes);
+        } catch (...) {
+            return false;
+        }
+        return Utils::writeFileAtomic(path, out.data(), out.size());
+    }
+
+    inline bool AtlasFileCache::load(
+            const std::filesystem::path& path,
+            std::uint64_t key,
+            ImFontAtlas& atlas,
+            std::unordered_map<FontRole, ImFont*>& fonts
+        ) {
+        Utils::MappedFile file(path);
+        if (!file.is_open()) return false;
+
+        const unsigned char* cur = file.data();
+        const unsigned char* const end = cur + file.size();
+        auto take = [&cur, end](auto& v) -> bool {
+            if (static_cast<std::size_t>(end - cur) < sizeof(v)) return false;
+            std::memcpy(&v, cur, sizeof(v));
+            cur += sizeof(v);
+            return true;
+        };
+
+        Header h{};
+        if (!take(h) ||
+            h.magic != kMagic ||
+            h.version != kVersion ||
+            h.key != key ||
+            h.imgui_version != static_cast<std::uint32_t>(IMGUI_VERSION_NUM) ||
+            h.line_count != static_cast<std::uint32_t>(IM_ARRAYSIZE(atlas.TexUvLines)) ||
+            h.font_count == 0 || h.tex_width == 0 || h.tex_height == 0) {
+            return false;
+        }
+
+        // Validate the whole file before touching the atlas.
+        std::vector<FontRecord> records(h.font_count);
+        std::vector<const unsigned char*> glyphs(h.font_count);
+        for (std::uint32_t i = 0; i < h.font_count; ++i) {
+            if (!take(records[i])) return false;
+            const std::size_t bytes = static_cast<std::size_t>(records[i].glyph_count) * sizeof(Glyph);
+            if (static_cast<std::size_t>(end - cur) < bytes) return false;
+            glyphs[i] = cur;
+            cur += bytes;
+        }
+        std::vector<RoleRecord> roles(h.role_count);
+        for (auto& r : roles) {
+            if (!take(r) || r.font_index >= h.font_count || r.role > static_cast<std::uint32_t>(FontRole::Emoji)) {
+                return false;
+            }
+        }
+        std::vector<ImVec4> lines(h.line_count);
+        for (auto& uv : lines) {
+            if (!take(uv)) return false;
+        }
+        const std::size_t pixel_bytes = static_cast<std::size_t>(h.tex_width) * h.tex_height * 4u;
+        if (static_cast<std::size_t>(end - cur) != pixel_bytes) return false;
+
+        atlas.Clear();
+        atlas.Flags = h.atlas_flags;
+
+        // Every restored font needs a config: BuildLookupTable() reads it.
+        for (std::uint32_t i = 0; i < h.font_count; ++i) {
+            ImFontConfig cfg;
+            cfg.FontData = nullptr;
+            cfg.FontDataSize = 0;
+            cfg.FontDataOwnedByAtlas = false;
+            cfg.SizePixels = records[i].size;
+            atlas.ConfigData.push_back(cfg);
+            atlas.Fonts.push_back(IM_NEW(ImFont)());
+        }
+        for (std::uint32_t i = 0; i < h.font_count; ++i) {
+            ImFont* font = atlas.Fonts[static_cast<int>(i)];
+            ImFontConfig& cfg = atlas.ConfigData[static_cast<int>(i)];
+            cfg.DstFont = font;
+            font->ContainerAtlas = &atlas;
+            font->ConfigData = &cfg;
+            font->ConfigDataCount = 1;
+            font->FontSize = records[i].size;
+            font->Ascent = records[i].ascent;
+            font->Descent = records[i].descent;
+            font->Glyphs.reserve(static_cast<int>(records[i].glyph_count));
+            const unsigned char* src = glyphs[i];
+            for (std::uint32_t k = 0; k < records[i].glyph_count; ++k, src += sizeof(Glyph)) {
+                Glyph gr;
+                std::memcpy(&gr, src, sizeof(gr));
+                ImFontGlyph g;
+                std::memset(&g, 0, sizeof(g));
+                g.Codepoint = gr.codepoint;
+                g.Visible = (gr.flags & 1u) != 0;
+                g.Colored = (gr.flags & 2u) != 0;
+                g.AdvanceX = gr.advance_x;
+                g.X0 = gr.x0; g.Y0 = gr.y0; g.X1 = gr.x1; g.Y1 = gr.y1;
+                g.U0 = gr.u0; g.V0 = gr.v0; g.U1 = gr.u1; g.V1 = gr.v1;
+                font->Glyphs.push_back(g);
+            }
+            font->BuildLookupTable();
+        }
+
+        atlas.TexWidth = static_cast<int>(h.tex_width);
+        atlas.TexHeight = static_cast<int>(h.tex_height);
+        atlas.TexUvScale = ImVec2(h.uv_scale[0], h.uv_scale[1]);
+        atlas.TexUvWhitePixel = ImVec2(h.uv_white_pixel[0], h.uv_white_pixel[1]);
+        for (std::uint32_t i = 0; i < h.line_count; ++i) atlas.TexUvLines[i] = lines[i];
+        atlas.TexPixelsRGBA32 = static_cast<unsigned int*>(IM_ALLOC(pixel_bytes));
+        std::memcpy(atlas.TexPixelsRGBA32, cur, pixel_bytes);
+        atlas.TexPixelsUseColors = true;
+#       if IMGUI_VERSION_NUM >= 18700
+        atlas.TexReady = true;
+#       endif
+
+        fonts.clear();
+        for (const auto& r : roles) {
+            fonts[static_cast<FontRole>(r.role)] = atlas.Fonts[static_cast<int>(r.font_index)];
+        }
+        return true;
+    }
+
+#else // IMGUI_VERSION_NUM >= 19200
+
+    inline bool AtlasFileCache::save(
+            const std::filesystem::path&,
+            std::uint64_t,
+            ImFontAtlas&,
+            const std::unordered_map<FontRole, ImFont*>&
+        ) noexcept {
+        return false; // glyphs are baked on demand; nothing to store
+    }
+
+    inline bool AtlasFileCache::load(
+            const std::filesystem::path&,
+            std::uint64_t,
+            ImFontAtlas&,
+            std::unordered_map<FontRole, ImFont*>&
+        ) {
+        return false;
+    }
+
+#endif
+
+} // namespace ImGuiX::Fonts
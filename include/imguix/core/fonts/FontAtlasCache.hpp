@@ -0,0 +1,103 @@
+#pragma once
+#ifndef _IMGUIX_FONTS_FONT_ATLAS_CACHE_HPP_INCLUDED
+#define _IMGUIX_FONTS_FONT_ATLAS_CACHE_HPP_INCLUDED
+
+/// \file FontAtlasCache.hpp
+/// \brief Font atlases shared between windows with identical font configuration.
+///
+/// In shared-atlas mode (see FontManager::setSharedAtlas()) a FontManager hashes
+/// its effective configuration (BuildParams, Markdown sizes, locale pack or manual
+/// buffer, glyph ranges) and asks the cache for the atlas of that key. The first
+/// window builds it; later windows bind the same ImFontAtlas to their ImGui
+/// context and reuse the fonts instead of rasterizing them again.
+///
+/// Notes:
+/// - An atlas lives while at least one FontManager holds it (shared_ptr).
+/// - GUI thread only, like the rest of FontManager.
+/// - WindowInstance takes the cache from the ResourceRegistry.
+
+#include <imgui.h>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "font_types.hpp"
+
+namespace ImGuiX::Fonts {
+
+    class FontManager;
+
+    /// \brief Rate limit of dynamic atlas trimming; one per atlas.
+    /// \details A shared atlas has several owners, but only one of them (the
+    ///          checker) looks at the budget each frame, so the cooldown counts
+    ///          frames and the atlas is trimmed once per interval.
+    struct AtlasTrimState {
+        int cooldown = 0;                     ///< Frames left before the budget is checked again.
+        const FontManager* checker = nullptr; ///< Owner that checks the budget.
+
+        /// \brief Return true if \p owner should compare the atlas with its budget now.
+        /// \note Counts down the cooldown; call once per frame and owner.
+        bool shouldCheck(const FontManager* owner) noexcept {
+            if (!checker) checker = owner;
+            if (checker != owner) return false;
+            if (cooldown > 0) {
+                --cooldown;
+                return false;
+            }
+            return true;
+        }
+
+        /// \brief Start the cooldown after a trim.
+        void trimmed() noexcept { cooldown = IMGUIX_FONTS_DYNAMIC_TRIM_INTERVAL; }
+
+        /// \brief Hand the checks over to the next owner that asks.
+        void release(const FontManager* owner) noexcept {
+            if (checker == owner) checker = nullptr;
+        }
+    };
+
+    /// \brief One shared atlas and the fonts built into it.
+    struct SharedFontAtlas {
+        /// \brief Destroys the atlas with IM_DELETE.
+        struct AtlasDeleter {
+            void operator()(ImFontAtlas* atlas) const;
+        };
+
+        std::uint64_t key = 0; ///< Configuration hash.
+        FontBlobs font_data; ///< TTF files referenced by the atlas; declared first so it outlives it.
+        std::unique_ptr<ImFontAtlas, AtlasDeleter> atlas; ///< Bound to the ImGui context of every owner.
+        std::unordered_map<FontRole, ImFont*> fonts; ///< Fonts of the last build.
+        std::uint64_t generation = 0; ///< Incremented by every build; 0 if never built.
+        bool dirty = false; ///< The next owner to sync rebuilds the atlas.
+        const FontManager* builder = nullptr; ///< Owner whose backend uploaded the texture.
+        AtlasTrimState trim; ///< Budget checks of all owners.
+    };
+
+    /// \class FontAtlasCache
+    /// \brief Registry of shared atlases keyed by configuration hash.
+    class FontAtlasCache : public std::enable_shared_from_this<FontAtlasCache> {
+    public:
+        FontAtlasCache() = default;
+
+        FontAtlasCache(const FontAtlasCache&) = delete;
+        FontAtlasCache& operator=(const FontAtlasCache&) = delete;
+
+        /// \brief Get the atlas of a configuration, creating an empty one if needed.
+        /// \param key Configuration hash.
+        /// \return Shared atlas; generation is 0 until somebody builds it.
+        std::shared_ptr<SharedFontAtlas> acquire(std::uint64_t key);
+
+        /// \brief Number of atlases that still have owners.
+        std::size_t size() const;
+
+    private:
+        std::unordered_map<std::uint64_t, std::weak_ptr<SharedFontAtlas>> m_atlases;
+    };
+
+} // namespace ImGuiX::Fonts
+
+#ifdef IMGUIX_HEADER_ONLY
+#   include "FontAtlasCache.ipp"
+#endif
+
+#endif // _IMGUIX_FONTS_FONT_ATLAS_CACHE_HPP_INCLUDED
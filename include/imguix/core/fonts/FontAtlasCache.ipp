@@ -0,0 +1,32 @@
+namespace ImGuiX::Fonts {
+
+    inline void SharedFontAtlas::AtlasDeleter::operator()(ImFontAtlas* atlas) const {
+        IM_DELETE(atlas);
+    }
+
+    inline std::shared_ptr<SharedFontAtlas> FontAtlasCache::acquire(std::uint64_t key) {
+        auto& slot = m_atlases[key];
+        if (auto entry = slot.lock()) return entry;
+
+        auto entry = std::make_shared<SharedFontAtlas>();
+        entry->key = key;
+        entry->atlas.reset(IM_NEW(ImFontAtlas)());
+        slot = entry;
+
+        // Drop slots of atlases whose last owner is gone.
+        for (auto it = m_atlases.begin(); it != m_atlases.end();) {
+            if (it->second.expired()) it = m_atlases.erase(it);
+            else ++it;
+        }
+        return entry;
+    }
+
+    inline std::size_t FontAtlasCache::size() const {
+        std::size_t n = 0;
+        for (const auto& kv : m_atlases) {
+            if (!kv.second.expired()) ++n;
+        }
+        return n;
+    }
+
+} // namespace ImGuiX::Fonts
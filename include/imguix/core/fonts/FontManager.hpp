@@ -1,7 +1,8 @@
 /// \file FontManager.hpp
-/// \brief Centralized font loading with optional JSON config (ImGui 1.92 +
+/// \brief Centralized font loading with optional JSON config (ImGui +
 /// FreeType + backend integration for SFML/GLFW/SDL2).
-/// \note Requires ImGui 1.92+, optional ImGui FreeType.
+/// \note Works with static atlases (ImGui < 1.92) and dynamic ones (1.92+);
+///       optional ImGui FreeType.
 ///
 /// Usage modes:
 /// 1) Auto-init from JSON (default): set config path (optional), call
@@ -10,19 +11,48 @@
 ///
 /// Threading: all methods that touch ImGuiIO::Fonts must be called on the GUI
 /// thread between frames.
+///
+/// Shared atlas: with setSharedAtlas(true) and a FontAtlasCache, windows whose
+/// font configuration is identical bind one ImFontAtlas to their ImGui contexts
+/// and build it once (see FontAtlasCache.hpp).
+///
+/// Dynamic glyphs: with setDynamicGlyphs(true) (ImGui 1.92+) no glyph ranges are
+/// preloaded; glyphs are baked when text first uses them, and bakes that were not
+/// used recently are evicted once the atlas exceeds its budget.
+///
+/// Disk cache: with setDiskCache(true) (ImGui < 1.92) baked atlases are stored
+/// under IMGUIX_FONTS_DISK_CACHE_DIR and restored on the next start without
+/// rasterizing (see AtlasFileCache.hpp).
+///
+/// Background rebuild: with setBackgroundRebuild(true) (ImGui < 1.92, private
+/// atlas) rebuildIfNeeded() reads and rasterizes fonts on a worker thread while
+/// the old atlas keeps rendering; applyRebuild() swaps the atlases and uploads
+/// the texture between frames. Requires a thread-local GImGui, see
+/// IMGUIX_FONTS_BACKGROUND_REBUILD.
 #pragma once
 #ifndef _IMGUIX_FONTS_FONT_MANAGER_HPP_INCLUDED
 #define _IMGUIX_FONTS_FONT_MANAGER_HPP_INCLUDED
 
 #include <imgui.h> // ImFont, ImWchar, ImGuiIO
+#include <cstdint>
 #include <filesystem>
+#include <future>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include "font_types.hpp"
+#include "FontAtlasCache.hpp"
+#include "AtlasFileCache.hpp"
 #include "FontManagerViewCRTP.hpp"
 #include "FontManagerControlCRTP.hpp"
 
+// ImGui::MemAlloc() on the worker would update the counters of the GUI
+// thread's context; a thread-local GImGui leaves the worker without one.
+#if IMGUIX_FONTS_BACKGROUND_REBUILD && !defined(GImGui)
+#   error "IMGUIX_FONTS_BACKGROUND_REBUILD requires a thread-local GImGui (#define GImGui in imconfig.h)"
+#endif
+
 namespace ImGuiX::Fonts {
 
     /// \brief Central manager for font atlas lifecycle.
@@ -95,6 +125,78 @@ namespace ImGuiX::Fonts {
         /// \brief Drop all registered locale packs.
         void clearPacks();
 
+        /// \brief Set the cache used to share atlases between managers.
+        /// \param cache Shared cache, usually taken from the ResourceRegistry.
+        void setAtlasCache(std::shared_ptr<FontAtlasCache> cache);
+
+        /// \brief Enable or disable shared-atlas mode. Default: IMGUIX_FONTS_SHARED_ATLAS.
+        /// \param enabled True to share the atlas with managers of identical configuration.
+        /// \note Takes effect at the next build; requires setAtlasCache().
+        void setSharedAtlas(bool enabled);
+
+        /// \brief Check whether shared-atlas mode is enabled.
+        /// \return True if the atlas is shared when a cache is set.
+        bool sharedAtlas() const noexcept { return m_shared_enabled; }
+
+        /// \brief Enable or disable the on-disk atlas cache. Default: IMGUIX_FONTS_DISK_CACHE.
+        /// \param enabled True to restore baked atlases from disk and store new ones.
+        /// \note Has no effect with ImGui 1.92+, which bakes glyphs on demand.
+        void setDiskCache(bool enabled);
+
+        /// \brief Set the directory of baked atlas files.
+        /// \param dir Directory; relative paths are resolved like the fonts directory.
+        void setDiskCacheDir(std::string dir);
+
+        /// \brief Enable or disable on-demand glyph baking. Default: IMGUIX_FONTS_DYNAMIC_GLYPHS.
+        /// \param enabled True to skip glyph ranges and bake glyphs when first drawn.
+        /// \note Requires ImGui 1.92+; ignored by older versions. Marks the atlas dirty.
+        void setDynamicGlyphs(bool enabled);
+
+        /// \brief Check whether glyphs are baked on demand.
+        /// \return True if dynamic glyphs are enabled and supported by ImGui.
+        bool dynamicGlyphs() const noexcept;
+
+        /// \brief Set the atlas texture budget.
+        /// \param bytes Texture size in bytes above which unused bakes are evicted; 0 disables trimming.
+        /// \note Applies to every atlas with ImGui 1.92+, which bakes glyphs on demand.
+        void setAtlasBudget(std::size_t bytes);
+
+        /// \brief Check whether the atlas has grown past its budget.
+        /// \return True if trimAtlas() should run; rate-limited after each trim.
+        /// \note Does not touch the ImGui context. For a shared atlas only one owner
+        ///       reports it, using its own budget.
+        bool isAtlasOverBudget() noexcept;
+
+        /// \brief Evict bakes that were not used recently and repack the texture.
+        /// \warning Must be called on the GUI thread between frames, with the
+        ///          owning window's ImGui context current.
+        void trimAtlas();
+
+        /// \brief Enable or disable background rebuilds. Default: IMGUIX_FONTS_BACKGROUND_REBUILD.
+        /// \param enabled True to rasterize rebuilt atlases on a worker thread.
+        /// \note Only private atlases of ImGui < 1.92 are rebuilt in the background;
+        ///       the first build, buildNow() and shared atlases stay synchronous.
+        ///       Ignored unless imconfig.h makes GImGui thread-local.
+        void setBackgroundRebuild(bool enabled);
+
+        /// \brief Check whether a background rebuild is running or waiting to be applied.
+        bool isRebuildPending() const noexcept { return m_pending_build.valid(); }
+
+        /// \brief Check whether a background rebuild has finished.
+        /// \return True if applyRebuild() can swap the atlas without waiting.
+        /// \note Does not touch the ImGui context.
+        bool isRebuildReady() const;
+
+        /// \brief Swap in the atlas of a finished background rebuild and upload it.
+        /// \warning Must be called on the GUI thread between frames, with the
+        ///          owning window's ImGui context current.
+        /// \return Result summary of the rebuild.
+        BuildResult applyRebuild();
+
+        /// \brief Check whether another owner rebuilt or invalidated the shared atlas.
+        /// \return True if rebuildIfNeeded() has work to do for the shared atlas.
+        bool isSharedAtlasStale() const noexcept;
+
         // ----------------- Manual mode API (JSON-less) -----------------
 
         /// \brief Start manual configuration without touching current atlas.
@@ -135,10 +237,15 @@ namespace ImGuiX::Fonts {
         BuildResult initFromJsonOrDefaults();
 
         /// \brief Mark atlas dirty after DPI/UI scale/locale/config change.
+        /// \note In shared mode the next rebuild switches to the atlas of the new
+        ///       configuration; if the configuration is unchanged, the shared atlas
+        ///       is rebuilt and the other owners pick it up via rebuildIfNeeded().
         void markDirty();
 
-        /// \brief Rebuild atlas if marked dirty.
+        /// \brief Rebuild atlas if marked dirty or if the shared atlas changed.
         /// \warning Must be called on the GUI thread between frames.
+        /// \note With background rebuilds the fonts change only in applyRebuild();
+        ///       until then the result holds the current fonts.
         /// \return Result summary of the rebuild.
         BuildResult rebuildIfNeeded();
 
@@ -170,7 +277,7 @@ namespace ImGuiX::Fonts {
         Control& control() noexcept { return *this; }
 
         FontManager() = default;
-        ~FontManager() = default;
+        ~FontManager();
 
     private:
         // Internal helpers
@@ -208,20 +315,127 @@ namespace ImGuiX::Fonts {
 
         // Manual configuration buffer
         PendingManual m_manual{};
-        // Keeps raw font bytes alive while the atlas uses AddFontFromMemoryTTF with external ownership.
-        std::vector<std::vector<unsigned char>> m_owned_font_data;
+        // Keeps font files mapped while the atlas uses AddFontFromMemoryTTF with external ownership.
+        FontBlobs m_owned_font_data;
+
+        // Shared-atlas mode
+        std::shared_ptr<FontAtlasCache> m_atlas_cache;
+        std::shared_ptr<SharedFontAtlas> m_shared; ///< Atlas bound to the current context, if shared.
+        std::uint64_t m_shared_generation = 0;     ///< Generation of m_shared whose fonts are adopted.
+        bool m_shared_enabled = IMGUIX_FONTS_SHARED_ATLAS != 0;
+
+        // Dynamic glyphs
+        bool m_dynamic_glyphs = IMGUIX_FONTS_DYNAMIC_GLYPHS != 0;
+        std::size_t m_atlas_budget = IMGUIX_FONTS_DYNAMIC_ATLAS_BUDGET;
+        AtlasTrimState m_trim;            ///< Budget checks of the private atlas.
+        ImFontAtlas* m_atlas = nullptr;   ///< Atlas of the last build or adoption.
+
+        // On-disk atlas cache
+        bool m_disk_cache_enabled = IMGUIX_FONTS_DISK_CACHE != 0;
+        std::string m_disk_cache_dir = IMGUIX_FONTS_DISK_CACHE_DIR;
+
+        /// \brief Snapshot of the configuration a build reads.
+        /// \details Copied on the GUI thread so that a worker never reads members
+        ///          the GUI thread may change meanwhile.
+        struct BuildInput {
+            BuildParams params{};
+            float px_body = 16.0f;
+            float px_h1 = 24.0f;
+            float px_h2 = 20.0f;
+            float px_h3 = 18.0f;
+            std::string active_locale;
+            PendingManual manual{};
+            LocalePack pack{};
+            bool has_pack = false;
+            bool dynamic = false;
+            bool bake = false;                         ///< Rasterize instead of leaving it to the upload.
+            std::filesystem::path base_dir_abs;
+            std::filesystem::path disk_cache_path;     ///< Empty if the disk cache is off.
+            std::uint64_t disk_key = 0;
+        };
+
+        /// \brief Atlas built by a worker, waiting for applyRebuild().
+        struct PendingBuild {
+            FontBlobs font_data; ///< Destroyed after the atlas that reads it.
+            std::unique_ptr<ImFontAtlas, SharedFontAtlas::AtlasDeleter> atlas;
+            std::unordered_map<FontRole, ImFont*> fonts;
+            std::string message;
+        };
+
+        // Background rebuild
+        bool m_background_rebuild = IMGUIX_FONTS_BACKGROUND_REBUILD != 0;
+        std::future<PendingBuild> m_pending_build;
+
+        /// \brief Locale pack used by the active locale, or nullptr.
+        const LocalePack* activePack() const;
+
+        /// \brief Hash of everything that affects the atlas contents.
+        /// \param files_dir If set, also hash size and mtime of the font files
+        ///        resolved against it, plus the ImGui version and build switches.
+        std::uint64_t configKey(const std::filesystem::path* files_dir = nullptr) const;
+
+        /// \brief Upload the built atlas and publish the fonts.
+        BuildResult finishBuild(BuildResult br);
+
+        /// \brief Copy the configuration of the next build.
+        BuildInput makeBuildInput() const;
+
+        /// \brief Check whether the next rebuild may run on a worker thread.
+        bool canRebuildInBackground() const;
+
+        /// \brief Start a worker building the current configuration.
+        BuildResult startBackgroundRebuild();
+
+        /// \brief Wait for a running background rebuild and drop its result.
+        void discardRebuild();
+
+        /// \brief Fill \p atlas with the fonts of \p in (or its disk cache file).
+        /// \details Touches neither the ImGui context nor FontManager members, so it
+        ///          may run on a worker thread with an atlas no context uses yet.
+        /// \param in Configuration snapshot.
+        /// \param atlas Empty atlas to fill.
+        /// \param owned_font_data Receives the mapped font files used by \p atlas.
+        /// \param reusable_font_data Mappings of the previous build to take over.
+        /// \param fonts Receives the role map.
+        /// \param message Receives the last error, if any.
+        static void bakeAtlas(
+            const BuildInput& in,
+            ImFontAtlas& atlas,
+            FontBlobs& owned_font_data,
+            FontBlobs& reusable_font_data,
+            std::unordered_map<FontRole, ImFont*>& fonts,
+            std::string& message
+        );
+
+        /// \brief Bind the shared atlas of the current configuration to the context.
+        /// \return True if it is already built and can be adopted without a rebuild.
+        bool acquireSharedAtlas();
+
+        /// \brief Trim rate limit of the atlas in use (shared or private).
+        AtlasTrimState& trimState() noexcept { return m_shared ? m_shared->trim : m_trim; }
+
+        /// \brief Leave the shared atlas; the context must not use it anymore.
+        void releaseSharedAtlas();
+
+        /// \brief Take fonts from the shared atlas without building.
+        BuildResult adoptSharedAtlas();
+
+        /// \brief Make \p atlas the ImGuiIO::Fonts of the current context.
+        /// \param atlas Atlas to bind.
+        /// \param owned_by_context True if the context should destroy it.
+        static void bindAtlas(ImFontAtlas* atlas, bool owned_by_context);
 
         // Internal static helpers
         static float scalePx(float px_96, const BuildParams& p);
 
         static void addLocaleRanges(
             ImFontGlyphRangesBuilder& b,
-            ImGuiIO& io,
+            ImFontAtlas& atlas,
             const std::string& locale);
 
         static void addNamedRanges(
             ImFontGlyphRangesBuilder& b,
-            ImGuiIO& io,
+            ImFontAtlas& atlas,
             const std::string& spec
         );
 
@@ -237,20 +451,23 @@ namespace ImGuiX::Fonts {
 
         static void buildRangesFromPack(
             std::vector<ImWchar>& out,
+            ImFontAtlas& atlas,
             const LocalePack* pack,
             const std::string& active_locale
         );
 
         static ImFont* addFontFile(
+            ImFontAtlas& atlas,
             const FontFile& ff,
             const BuildParams& params,
             const std::vector<ImWchar>& ranges,
             const std::filesystem::path& base_dir_abs,
-            std::vector<std::vector<unsigned char>>& owned_font_data,
+            FontBlobs& owned_font_data,
+            FontBlobs& reusable_font_data,
             const ImFontConfig& base_cfg
         );
 
-        static void setupFreetypeIfNeeded(const BuildParams& params);
+        static void setupFreetypeIfNeeded(ImFontAtlas& atlas, const BuildParams& params);
 
         static bool updateBackendTexture();
 
@@ -1,11 +1,14 @@
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <fstream>
 #include <limits>
 #include <sstream>
 #include <utility>
 #include <iostream>
 
+#include <imgui_internal.h> // ImGuiContext: binding a shared atlas
+
 #ifdef IMGUIX_FONTS_ENABLE_JSON
 #include <nlohmann/json.hpp>
 #endif
@@ -14,6 +17,7 @@
 #include <imgui_freetype.h>
 #endif
 
+#include <imguix/utils/fnv1a.hpp>
 #include <imguix/utils/path_utils.hpp>
 #include <imguix/config/fonts.hpp>
 
@@ -144,6 +148,265 @@ namespace ImGuiX::Fonts {
     }
     inline const BuildParams &FontManager::params() const { return m_params; }
 
+    inline FontManager::~FontManager() {
+        // The ImGui context is already gone here; only the shared entry is updated.
+        if (m_shared) m_shared->trim.release(this);
+        if (m_shared && m_shared->builder == this) {
+            m_shared->builder = nullptr;
+#           if IMGUI_VERSION_NUM < 19200
+            // Pre-1.92 backends destroy the font texture with the window.
+            m_shared->dirty = true;
+#           endif
+        }
+    }
+
+    inline void FontManager::setAtlasCache(std::shared_ptr<FontAtlasCache> cache) {
+        m_atlas_cache = std::move(cache);
+    }
+
+    inline void FontManager::setSharedAtlas(bool enabled) {
+        if (enabled == m_shared_enabled) return;
+        m_shared_enabled = enabled;
+        markDirty();
+    }
+
+    inline void FontManager::setDiskCache(bool enabled) {
+        m_disk_cache_enabled = enabled;
+    }
+
+    inline void FontManager::setDiskCacheDir(std::string dir) {
+        m_disk_cache_dir = std::move(dir);
+    }
+
+    inline void FontManager::setDynamicGlyphs(bool enabled) {
+        if (enabled == m_dynamic_glyphs) return;
+        m_dynamic_glyphs = enabled;
+        markDirty();
+    }
+
+    inline bool FontManager::dynamicGlyphs() const noexcept {
+#       if IMGUI_VERSION_NUM >= 19200
+        return m_dynamic_glyphs;
+#       else
+        return false;
+#       endif
+    }
+
+    inline void FontManager::setAtlasBudget(std::size_t bytes) {
+        m_atlas_budget = bytes;
+    }
+
+    inline void FontManager::setBackgroundRebuild(bool enabled) {
+        m_background_rebuild = enabled;
+    }
+
+    inline bool FontManager::isAtlasOverBudget() noexcept {
+#       if IMGUI_VERSION_NUM >= 19200
+        if (m_atlas_budget == 0 || !m_atlas || !m_atlas->TexData) return false;
+        if (!trimState().shouldCheck(this)) return false;
+        const ImTextureData* tex = m_atlas->TexData;
+        const std::size_t bytes = static_cast<std::size_t>(tex->Width) *
+                                  static_cast<std::size_t>(tex->Height) *
+                                  static_cast<std::size_t>(tex->BytesPerPixel);
+        return bytes > m_atlas_budget;
+#       else
+        return false;
+#       endif
+    }
+
+    inline void FontManager::trimAtlas() {
+#       if IMGUI_VERSION_NUM >= 19200
+        // Drops baked sizes unused since the last frames (least recently used
+        // first) and repacks the remaining glyphs into a smaller texture.
+        ImGui::GetIO().Fonts->CompactCache();
+#       endif
+        // Text on screen is baked again at once; do not thrash if it is all in use.
+        trimState().trimmed();
+    }
+
+    inline bool FontManager::isSharedAtlasStale() const noexcept {
+        return m_shared && (m_shared->dirty || m_shared->generation != m_shared_generation);
+    }
+
+    /// ----------------------------
+    /// Shared atlas
+    /// ----------------------------
+
+    inline const LocalePack* FontManager::activePack() const {
+        auto it = m_packs.find(m_active_locale);
+        if (it != m_packs.end()) return &it->second;
+        auto it2 = m_packs.find(u8"default");
+        return it2 != m_packs.end() ? &it2->second : nullptr;
+    }
+
+    inline std::uint64_t FontManager::configKey(const fs::path* files_dir) const {
+        Utils::Fnv1a h;
+        auto mix = [&h](const void* data, std::size_t size) { h.add(data, size); };
+        auto mix_pod = [&h](const auto& v) { h.addPod(v); };
+        auto mix_str = [&](const std::string& str) {
+            mix_pod(str.size());
+            mix(str.data(), str.size());
+        };
+        auto mix_stat = [&](const std::string& path) {
+            if (!files_dir) return;
+            const fs::path p = fs::u8path(path);
+            const fs::path resolved = (p.is_absolute() ? p : (*files_dir / p)).lexically_normal();
+            std::error_code ec;
+            const auto size = static_cast<std::uint64_t>(fs::file_size(resolved, ec));
+            const auto mtime = static_cast<std::int64_t>(fs::last_write_time(resolved, ec).time_since_epoch().count());
+            mix_pod(size);
+            mix_pod(mtime);
+        };
+        auto mix_file = [&](const FontFile& ff) {
+            mix_str(ff.path);
+            mix_stat(ff.path);
+            mix_pod(ff.size_px);
+            mix_pod(ff.baseline_offset_px);
+            mix_pod(ff.merge);
+            mix_pod(ff.freetype_flags);
+            mix_str(ff.extra_glyphs);
+        };
+        auto mix_files = [&](const std::vector<FontFile>& files) {
+            mix_pod(files.size());
+            for (const auto& ff : files) mix_file(ff);
+        };
+        auto mix_ranges = [&](const std::vector<ImWchar>& ranges) {
+            mix_pod(ranges.size());
+            mix(ranges.data(), ranges.size() * sizeof(ImWchar));
+        };
+        // Fixed order; unordered_map iteration order is not stable across managers.
+        static constexpr FontRole kRoles[] = {
+            FontRole::Body, FontRole::H1, FontRole::H2, FontRole::H3,
+            FontRole::Monospace, FontRole::Bold, FontRole::Italic,
+            FontRole::BoldItalic, FontRole::Icons, FontRole::Emoji
+        };
+
+        mix_pod(m_params.dpi);
+        mix_pod(m_params.ui_scale);
+        mix_str(m_params.base_dir);
+        mix_pod(m_params.use_freetype);
+        mix_pod(m_px_body);
+        mix_pod(m_px_h1);
+        mix_pod(m_px_h2);
+        mix_pod(m_px_h3);
+        mix_str(m_active_locale); // locale fallback ranges
+        mix_pod(m_manual.active);
+        const bool dynamic = dynamicGlyphs();
+        mix_pod(dynamic);
+
+        if (files_dir) {
+            // Baked pixels also depend on the rasterizer and on build switches.
+            const int imgui_version = IMGUI_VERSION_NUM;
+            mix_pod(imgui_version);
+#           ifdef IMGUI_ENABLE_FREETYPE
+            mix_pod(true);
+#           else
+            mix_pod(false);
+#           endif
+            const int suppress_flags = (IMGUIX_SUPPRESS_EMOJI_CONTROL_GLYPHS ? 1 : 0) |
+                                       (IMGUIX_SUPPRESS_KEYCAP_COMBINING ? 2 : 0);
+            mix_pod(suppress_flags);
+            mix_stat(IMGUIX_FONTS_FALLBACK_BODY_BASENAME);
+            mix_stat(IMGUIX_FONTS_FALLBACK_ICONS_BASENAME);
+        }
+
+        if (m_manual.active) {
+            mix_pod(m_manual.has_body);
+            if (m_manual.has_body) mix_file(m_manual.body);
+            for (FontRole role : kRoles) {
+                auto it = m_manual.headlines.find(role);
+                const bool has = it != m_manual.headlines.end();
+                mix_pod(has);
+                if (has) mix_file(it->second);
+            }
+            mix_files(m_manual.merges_icons);
+            mix_files(m_manual.merges_emoji);
+            mix_files(m_manual.merges_unknown);
+            mix_ranges(m_manual.ranges);
+            mix_str(m_manual.ranges_preset);
+        } else if (const LocalePack* pack = activePack()) {
+            mix_str(pack->locale);
+            for (FontRole role : kRoles) {
+                auto it = pack->roles.find(role);
+                if (it == pack->roles.end()) {
+                    mix_pod(std::size_t{0});
+                } else {
+                    mix_files(it->second);
+                }
+            }
+            mix_ranges(pack->ranges);
+            mix_str(pack->ranges_preset);
+        }
+        return h.value();
+    }
+
+    inline void FontManager::bindAtlas(ImFontAtlas* atlas, bool owned_by_context) {
+        ImGuiContext& g = *ImGui::GetCurrentContext();
+        ImFontAtlas* old = g.IO.Fonts;
+        if (old == atlas) return;
+#       if IMGUI_VERSION_NUM >= 19200
+        ImGui::UnregisterFontAtlas(old);
+        if (old->OwnerContext == &g) {
+            old->Locked = false;
+            IM_DELETE(old);
+        }
+        g.IO.Fonts = atlas;
+        if (owned_by_context) atlas->OwnerContext = &g;
+        ImGui::RegisterFontAtlas(atlas);
+#       else
+        if (g.FontAtlasOwnedByContext) {
+            old->Locked = false;
+            IM_DELETE(old);
+        }
+        g.IO.Fonts = atlas;
+        g.FontAtlasOwnedByContext = owned_by_context;
+#       endif
+        g.IO.FontDefault = nullptr;
+    }
+
+    inline bool FontManager::acquireSharedAtlas() {
+        const std::uint64_t key = configKey();
+        const bool same = m_shared && m_shared->key == key;
+        if (!same) {
+            // Bind the new atlas before the old one may be destroyed.
+            auto entry = m_atlas_cache->acquire(key);
+            bindAtlas(entry->atlas.get(), false);
+            m_owned_font_data.clear(); // the private atlas, if any, is gone
+            releaseSharedAtlas();
+            m_shared = std::move(entry);
+        }
+        if (m_shared->generation == 0 || m_shared->dirty) return false;
+        // markDirty() without a configuration change forces a rebuild for all owners.
+        return !(same && m_dirty && m_shared_generation == m_shared->generation);
+    }
+
+    inline void FontManager::releaseSharedAtlas() {
+        if (!m_shared) return;
+        m_shared->trim.release(this);
+        if (m_shared->builder == this) {
+            m_shared->builder = nullptr;
+#           if IMGUI_VERSION_NUM < 19200
+            // Our backend texture is about to hold another atlas.
+            m_shared->dirty = true;
+#           endif
+        }
+        m_shared.reset();
+        m_shared_generation = 0;
+    }
+
+    inline BuildResult FontManager::adoptSharedAtlas() {
+        m_atlas = m_shared->atlas.get();
+        m_fonts = m_shared->fonts;
+        m_shared_generation = m_shared->generation;
+        m_dirty = false;
+        ImGui::GetIO().FontDefault = getFont(FontRole::Body);
+
+        BuildResult br{};
+        br.success = true;
+        br.fonts = m_fonts;
+        return br;
+    }
+
     /// ----------------------------
     /// Heavy helpers (implementation)
     /// ----------------------------
@@ -158,11 +421,11 @@ namespace ImGuiX::Fonts {
     /// \note Keep conservative defaults to avoid huge atlases.
     inline void FontManager::addLocaleRanges(
             ImFontGlyphRangesBuilder &b,
-            ImGuiIO &io,
+            ImFontAtlas &atlas,
             const std::string &locale
         ) {
         // Always include default UI symbols
-        b.AddRanges(io.Fonts->GetGlyphRangesDefault());
+        b.AddRanges(atlas.GetGlyphRangesDefault());
 
         // Common add-ons: punctuation seen in many UIs
         b.AddText(u8"–—…•“”‘’"); // en/em dashes, ellipsis, bullets, quotes
@@ -174,19 +437,19 @@ namespace ImGuiX::Fonts {
             locale == u8"bg" || 
             locale == u8"kk" ||
             locale == u8"sr") {
-            b.AddRanges(io.Fonts->GetGlyphRangesCyrillic());
+            b.AddRanges(atlas.GetGlyphRangesCyrillic());
         }
 
         // Vietnamese
-        if (locale == u8"vi") b.AddRanges(io.Fonts->GetGlyphRangesVietnamese());
+        if (locale == u8"vi") b.AddRanges(atlas.GetGlyphRangesVietnamese());
 
         // CJK (careful: large)
         if (locale == u8"ja")
-            b.AddRanges(io.Fonts->GetGlyphRangesJapanese());
+            b.AddRanges(atlas.GetGlyphRangesJapanese());
         else if (locale == u8"zh" || locale == u8"zh-CN" || locale == u8"zh-TW")
-            b.AddRanges(io.Fonts->GetGlyphRangesChineseFull());
+            b.AddRanges(atlas.GetGlyphRangesChineseFull());
         else if (locale == u8"ko")
-            b.AddRanges(io.Fonts->GetGlyphRangesKorean());
+            b.AddRanges(atlas.GetGlyphRangesKorean());
 
         // RTL (Arabic/Hebrew) – ImGui does not provide built-ins for all subsets;
         // user usually supplies proper ranges via JSON LocalePack::ranges or custom
@@ -199,7 +462,7 @@ namespace ImGuiX::Fonts {
 
     inline void FontManager::addNamedRanges(
             ImFontGlyphRangesBuilder& b,
-            ImGuiIO& io, 
+            ImFontAtlas& atlas,
             const std::string& spec
         ) {
         auto split = [](const std::string& s) {
@@ -235,12 +498,12 @@ namespace ImGuiX::Fonts {
             return out;
         };
         for (auto tok : split(spec)) {
-            if (tok == u8"Default")          b.AddRanges(io.Fonts->GetGlyphRangesDefault());
-            else if (tok == u8"Cyrillic")    b.AddRanges(io.Fonts->GetGlyphRangesCyrillic());
-            else if (tok == u8"Vietnamese")  b.AddRanges(io.Fonts->GetGlyphRangesVietnamese());
-            else if (tok == u8"Japanese" || tok == u8"JapaneseFull") b.AddRanges(io.Fonts->GetGlyphRangesJapanese());
-            else if (tok == u8"Chinese"  || tok == u8"ChineseFull")  b.AddRanges(io.Fonts->GetGlyphRangesChineseFull());
-            else if (tok == u8"Korean")      b.AddRanges(io.Fonts->GetGlyphRangesKorean());
+            if (tok == u8"Default")          b.AddRanges(atlas.GetGlyphRangesDefault());
+            else if (tok == u8"Cyrillic")    b.AddRanges(atlas.GetGlyphRangesCyrillic());
+            else if (tok == u8"Vietnamese")  b.AddRanges(atlas.GetGlyphRangesVietnamese());
+            else if (tok == u8"Japanese" || tok == u8"JapaneseFull") b.AddRanges(atlas.GetGlyphRangesJapanese());
+            else if (tok == u8"Chinese"  || tok == u8"ChineseFull")  b.AddRanges(atlas.GetGlyphRangesChineseFull());
+            else if (tok == u8"Korean")      b.AddRanges(atlas.GetGlyphRangesKorean());
             else if (tok == u8"Punct")       b.AddText(u8"–—…•“”‘’");
             else if (tok == u8"PUA" || tok == u8"Icons" || tok == u8"PrivateUse") {
                 // Private Use Area (BMP
@@ -450,15 +713,15 @@ namespace ImGuiX::Fonts {
     /// \details Combines named presets (ranges_preset), explicit pairs (ranges),
     ///          locale-based defaults, and per-file extra_glyphs (UTF-8).
     inline void FontManager::buildRangesFromPack(std::vector<ImWchar> &out,
+                                                 ImFontAtlas &atlas,
                                                  const LocalePack *pack,
                                                  const std::string &active_locale) {
-      ImGuiIO &io = ImGui::GetIO();
       ImFontGlyphRangesBuilder b;
 
       if (pack) {
         // 1) Preset string (named + numeric tokens).
         if (!pack->ranges_preset.empty())
-          addNamedRanges(b, io, pack->ranges_preset);
+          addNamedRanges(b, atlas, pack->ranges_preset);
 
         // 2) Explicit [start,end] pairs (0-terminated). Ensure terminator.
         if (!pack->ranges.empty()) {
@@ -474,7 +737,7 @@ namespace ImGuiX::Fonts {
         // 3) If neither presets nor explicit ranges given, fall back to locale
         // defaults.
         if (pack->ranges_preset.empty() && pack->ranges.empty())
-          addLocaleRanges(b, io, active_locale);
+          addLocaleRanges(b, atlas, active_locale);
 
         // 4) Common punctuation (harmless to add twice; builder deduplicates).
         b.AddText(u8"–—…•“”‘’");
@@ -486,7 +749,7 @@ namespace ImGuiX::Fonts {
               addExtraGlyphs(b, ff.extra_glyphs);
       } else {
         // No pack: locale-based defaults + punctuation.
-        addLocaleRanges(b, io, active_locale);
+        addLocaleRanges(b, atlas, active_locale);
         b.AddText(u8"–—…•“”‘’");
       }
 
@@ -497,12 +760,17 @@ namespace ImGuiX::Fonts {
 
     /// \brief Add a font file to ImGui atlas (respecting merge flag, size scaling
     /// and ranges).
+    /// \details Each resolved path is mapped once per build; roles reusing the
+    /// file (e.g. Body for H1/H2/H3) share the mapping. Mappings of the previous
+    /// build are taken over from \p reusable_font_data instead of mapping again.
     inline ImFont *FontManager::addFontFile(
+            ImFontAtlas &atlas,
             const FontFile &ff,
             const BuildParams &params,
             const std::vector<ImWchar> &ranges,
             const fs::path &base_dir_abs,
-            std::vector<std::vector<unsigned char>> &owned_font_data,
+            FontBlobs &owned_font_data,
+            FontBlobs &reusable_font_data,
             const ImFontConfig &base_cfg
         ) {
         ImFontConfig cfg = base_cfg;
@@ -516,28 +784,26 @@ namespace ImGuiX::Fonts {
         fs::path p = fs::u8path(ff.path);
         const fs::path resolved_p = (p.is_absolute() ? p : (base_dir_abs / p)).lexically_normal();
 
-        std::ifstream input(resolved_p, std::ios::binary);
-        if (!input.good()) {
-            return nullptr;
-        }
-
-        input.seekg(0, std::ios::end);
-        const std::streamoff size = input.tellg();
-        if (size <= 0) {
-            return nullptr;
-        }
-        input.seekg(0, std::ios::beg);
-
-        owned_font_data.emplace_back(static_cast<size_t>(size));
-        std::vector<unsigned char>& font_data = owned_font_data.back();
-        input.read(reinterpret_cast<char*>(font_data.data()), static_cast<std::streamsize>(size));
-        if (!input.good() && !input.eof()) {
-            owned_font_data.pop_back();
-            return nullptr;
+        const std::string key = resolved_p.u8string();
+        auto it = owned_font_data.find(key);
+        if (it == owned_font_data.end()) {
+            auto old = reusable_font_data.find(key);
+            if (old != reusable_font_data.end()) {
+                it = owned_font_data.emplace(key, std::move(old->second)).first;
+                reusable_font_data.erase(old);
+            } else {
+                Utils::MappedFile file(resolved_p);
+                if (!file.is_open()) {
+                    return nullptr;
+                }
+                it = owned_font_data.emplace(key, std::move(file)).first;
+            }
         }
+        const Utils::MappedFile& font_data = it->second;
 
-        return ImGui::GetIO().Fonts->AddFontFromMemoryTTF(
-            font_data.data(),
+        // The atlas does not own the bytes and only reads them (FontDataOwnedByAtlas = false).
+        return atlas.AddFontFromMemoryTTF(
+            const_cast<unsigned char*>(font_data.data()),
             static_cast<int>(font_data.size()),
             eff_px,
             &cfg,
@@ -545,17 +811,18 @@ namespace ImGuiX::Fonts {
     }
 
     /// \brief Switch FreeType builder for ImGui if requested and available.
-    inline void FontManager::setupFreetypeIfNeeded(const BuildParams &params) {
+    inline void FontManager::setupFreetypeIfNeeded(ImFontAtlas &atlas, const BuildParams &params) {
 #   ifdef IMGUI_ENABLE_FREETYPE
         if (!params.use_freetype) return;
 #       if IMGUI_VERSION_NUM >= 19200
-        ImGui::GetIO().Fonts->FontLoader = ImGuiFreeType::GetFontLoader();
-        ImGui::GetIO().Fonts->FontLoaderFlags = 0;
+        atlas.FontLoader = ImGuiFreeType::GetFontLoader();
+        atlas.FontLoaderFlags = 0;
 #       else
-        ImGui::GetIO().Fonts->FontBuilderIO = ImGuiFreeType::GetBuilderForFreeType();
-        ImGui::GetIO().Fonts->FontBuilderFlags = 0;
+        atlas.FontBuilderIO = ImGuiFreeType::GetBuilderForFreeType();
+        atlas.FontBuilderFlags = 0;
 #       endif
 #   else
+        (void)atlas;
         (void)params;
 #   endif
     }
@@ -605,39 +872,90 @@ namespace ImGuiX::Fonts {
 #       endif
     }
 
-    inline BuildResult FontManager::buildNow() {
-        BuildResult br{};
+    inline FontManager::BuildInput FontManager::makeBuildInput() const {
+        BuildInput in{};
+        in.params = m_params;
+        in.px_body = m_px_body;
+        in.px_h1 = m_px_h1;
+        in.px_h2 = m_px_h2;
+        in.px_h3 = m_px_h3;
+        in.active_locale = m_active_locale;
+        in.manual = m_manual;
+        if (const LocalePack* pack = m_manual.active ? nullptr : activePack()) {
+            in.pack = *pack;
+            in.has_pack = true;
+        }
+        in.dynamic = dynamicGlyphs();
 
-        fs::path base_dir_abs;
 #       ifdef __EMSCRIPTEN__
-        base_dir_abs = fs::u8path(m_params.base_dir);
+        in.base_dir_abs = fs::u8path(m_params.base_dir);
 #       else
-        base_dir_abs = ImGuiX::Utils::resolveExecPathFs(fs::u8path(m_params.base_dir));
+        in.base_dir_abs = ImGuiX::Utils::resolveExecPathFs(fs::u8path(m_params.base_dir));
 #       endif
 
+        if (m_disk_cache_enabled && AtlasFileCache::isSupported()) {
+            fs::path cache_dir;
+#           ifdef __EMSCRIPTEN__
+            cache_dir = fs::u8path(m_disk_cache_dir);
+#           else
+            cache_dir = ImGuiX::Utils::resolveExecPathFs(fs::u8path(m_disk_cache_dir));
+#           endif
+            in.disk_key = configKey(&in.base_dir_abs);
+            in.disk_cache_path = AtlasFileCache::pathFor(cache_dir, in.disk_key);
+        }
+        return in;
+    }
+
+    inline BuildResult FontManager::buildNow() {
+        BuildResult br{};
+        discardRebuild();
+
+        if (m_shared_enabled && m_atlas_cache) {
+            if (acquireSharedAtlas()) return adoptSharedAtlas();
+        } else if (m_shared) {
+            // Shared mode was turned off: go back to a private atlas.
+            bindAtlas(IM_NEW(ImFontAtlas)(), true);
+            releaseSharedAtlas();
+        }
+        FontBlobs& owned_font_data = m_shared ? m_shared->font_data : m_owned_font_data;
+        const BuildInput in = makeBuildInput();
+
         // We support either manual buffer (if active) or the active locale pack.
         ImGuiIO &io = ImGui::GetIO();
-        m_owned_font_data.clear();
         io.Fonts->Clear();
+        // Files still used by the new configuration keep their mapping; the rest
+        // is unmapped when this build returns.
+        FontBlobs reusable_font_data;
+        reusable_font_data.swap(owned_font_data);
         io.FontDefault = nullptr;
+        m_fonts.clear();
+
+        bakeAtlas(in, *io.Fonts, owned_font_data, reusable_font_data, m_fonts, br.message);
+        return finishBuild(std::move(br));
+    }
+
+    inline void FontManager::bakeAtlas(
+            const BuildInput& in,
+            ImFontAtlas& atlas,
+            FontBlobs& owned_font_data,
+            FontBlobs& reusable_font_data,
+            std::unordered_map<FontRole, ImFont*>& fonts,
+            std::string& message
+        ) {
+        setupFreetypeIfNeeded(atlas, in.params);
 
-        setupFreetypeIfNeeded(m_params);
+        // 0) Baked atlas of a previous run
+        if (!in.disk_cache_path.empty() &&
+            AtlasFileCache::load(in.disk_cache_path, in.disk_key, atlas, fonts)) {
+            return;
+        }
         
         // 1) Select pack_ptr for active locale (if not manual)
-        const LocalePack* pack_ptr = nullptr;
-        if (!m_manual.active) {
-            auto it = m_packs.find(m_active_locale);
-            if (it == m_packs.end()) {
-                auto it2 = m_packs.find(u8"default");
-                if (it2 != m_packs.end()) pack_ptr = &it2->second;
-            } else {
-                pack_ptr = &it->second;
-            }
-        }
+        const LocalePack* pack_ptr = in.manual.active || !in.has_pack ? nullptr : &in.pack;
         
         // 2) Collect FreeType flags from all FontFile
         unsigned int ft_flags = 0;
-        if (!m_manual.active) {
+        if (!in.manual.active) {
             const LocalePack* p = pack_ptr;
             if (p) {
                 for (const auto& role_vec : p->roles) {
@@ -647,56 +965,59 @@ namespace ImGuiX::Fonts {
                 }
             }
         } else {
-            if (m_manual.has_body) ft_flags |= m_manual.body.freetype_flags;
-            for (const auto& kv : m_manual.headlines) ft_flags |= kv.second.freetype_flags;
-            for (const auto& ff : m_manual.merges_icons)   ft_flags |= ff.freetype_flags;
-            for (const auto& ff : m_manual.merges_emoji)   ft_flags |= ff.freetype_flags;
-            for (const auto& ff : m_manual.merges_unknown) ft_flags |= ff.freetype_flags;
+            if (in.manual.has_body) ft_flags |= in.manual.body.freetype_flags;
+            for (const auto& kv : in.manual.headlines) ft_flags |= kv.second.freetype_flags;
+            for (const auto& ff : in.manual.merges_icons)   ft_flags |= ff.freetype_flags;
+            for (const auto& ff : in.manual.merges_emoji)   ft_flags |= ff.freetype_flags;
+            for (const auto& ff : in.manual.merges_unknown) ft_flags |= ff.freetype_flags;
         }
 
         // 3) Apply flags to atlas before adding any fonts into the atlas.
 #   ifdef IMGUI_ENABLE_FREETYPE
 #       if IMGUI_VERSION_NUM >= 19200
-        ImGui::GetIO().Fonts->FontLoaderFlags = ft_flags;
+        atlas.FontLoaderFlags = ft_flags;
 #       else
-        ImGui::GetIO().Fonts->FontBuilderFlags = ft_flags;
+        atlas.FontBuilderFlags = ft_flags;
 #       endif
 #   endif
 
         // Build ranges
         // 4) Gather ranges
         std::vector<ImWchar> ranges;
-        if (!m_manual.active) {
-            buildRangesFromPack(ranges, pack_ptr, m_active_locale);
+        if (in.dynamic) {
+            // No ranges: every glyph of the font is available and baked when first drawn.
+        } else
+        if (!in.manual.active) {
+            buildRangesFromPack(ranges, atlas, pack_ptr, in.active_locale);
         } else {
             // Manual ranges: use default builder with extra glyphs from manual entries
             ImFontGlyphRangesBuilder b;
 
             // 1) Priority: preset → explicit pairs → locale fallback
-            if (!m_manual.ranges_preset.empty()) {
-                addNamedRanges(b, io, m_manual.ranges_preset);
+            if (!in.manual.ranges_preset.empty()) {
+                addNamedRanges(b, atlas, in.manual.ranges_preset);
             } else 
-            if (!m_manual.ranges.empty()) {
-                if (m_manual.ranges.back() == 0) {
-                    b.AddRanges(m_manual.ranges.data());
+            if (!in.manual.ranges.empty()) {
+                if (in.manual.ranges.back() == 0) {
+                    b.AddRanges(in.manual.ranges.data());
                 } else {
-                    auto tmp = m_manual.ranges;
+                    auto tmp = in.manual.ranges;
                     tmp.push_back(0);
                     b.AddRanges(tmp.data());
                 }
             } else {
-                addLocaleRanges(b, io, m_active_locale);
+                addLocaleRanges(b, atlas, in.active_locale);
             }
 
             // 2) Useful punctuation (deduplicated inside builder)
             b.AddText(u8"–—…•“”‘’");
 
             // 3) Extra glyphs from all manual config sources
-            if (m_manual.has_body) addExtraGlyphs(b, m_manual.body.extra_glyphs);
-            for (const auto& kv : m_manual.headlines)      addExtraGlyphs(b, kv.second.extra_glyphs);
-            for (const auto& ff : m_manual.merges_icons)   addExtraGlyphs(b, ff.extra_glyphs);
-            for (const auto& ff : m_manual.merges_emoji)   addExtraGlyphs(b, ff.extra_glyphs);
-            for (const auto& ff : m_manual.merges_unknown) addExtraGlyphs(b, ff.extra_glyphs);
+            if (in.manual.has_body) addExtraGlyphs(b, in.manual.body.extra_glyphs);
+            for (const auto& kv : in.manual.headlines)      addExtraGlyphs(b, kv.second.extra_glyphs);
+            for (const auto& ff : in.manual.merges_icons)   addExtraGlyphs(b, ff.extra_glyphs);
+            for (const auto& ff : in.manual.merges_emoji)   addExtraGlyphs(b, ff.extra_glyphs);
+            for (const auto& ff : in.manual.merges_unknown) addExtraGlyphs(b, ff.extra_glyphs);
 
             ImVector<ImWchar> r;
             b.BuildRanges(&r);
@@ -709,7 +1030,7 @@ namespace ImGuiX::Fonts {
         cfg.OversampleV = 1;
         cfg.PixelSnapH = false;
 
-        m_fonts.clear();
+        fonts.clear();
 
         // Add Body first (either from pack or from manual)
         ImFont *body = nullptr;
@@ -724,25 +1045,25 @@ namespace ImGuiX::Fonts {
                 local.MergeMode = (i > 0) ? 
                     (local.MergeMode || vec[i].merge) : 
                     vec[i].merge;
-                ImFont *f = addFontFile(vec[i], m_params, ranges, base_dir_abs, m_owned_font_data, local);
+                ImFont *f = addFontFile(atlas, vec[i], in.params, ranges, in.base_dir_abs, owned_font_data, reusable_font_data, local);
                 if (!f) {
-                    br.message = u8"Failed to load font: " + vec[i].path;
+                    message = u8"Failed to load font: " + vec[i].path;
                 }
                 last = f;
             }
-            if (last) m_fonts[role] = last;
+            if (last) fonts[role] = last;
             return last;
         };
 
         auto add_single = [&](FontRole role, const FontFile &ff) -> ImFont * {
-            ImFont *f = addFontFile(ff, m_params, ranges, base_dir_abs, m_owned_font_data, cfg);
-            if (f) m_fonts[role] = f;
-            else br.message = u8"Failed to load font: " + ff.path;
+            ImFont *f = addFontFile(atlas, ff, in.params, ranges, in.base_dir_abs, owned_font_data, reusable_font_data, cfg);
+            if (f) fonts[role] = f;
+            else message = u8"Failed to load font: " + ff.path;
             return f;
         };
 
         // Strategy per mode
-        if (!m_manual.active) {
+        if (!in.manual.active) {
         // --- PACK MODE ---
         // Body
         if (pack_ptr) {
@@ -756,23 +1077,23 @@ namespace ImGuiX::Fonts {
             for (const auto &ff : it->second) {
               FontFile mff = ff;
               mff.merge = true;
-              ImFont *f = addFontFile(mff, m_params, ranges, base_dir_abs, m_owned_font_data, cfg);
+              ImFont *f = addFontFile(atlas, mff, in.params, ranges, in.base_dir_abs, owned_font_data, reusable_font_data, cfg);
               (void)f; // merged; no separate role pointer necessary
             }
             // record role as present (point to Body for retrieval semantics)
             if (body)
-              m_fonts[FontRole::Icons] = body;
+              fonts[FontRole::Icons] = body;
           }
           if (auto it = pack_ptr->roles.find(FontRole::Emoji);
               it != pack_ptr->roles.end()) {
             for (const auto &ff : it->second) {
               FontFile mff = ff;
               mff.merge = true;
-              ImFont *f = addFontFile(mff, m_params, ranges, base_dir_abs, m_owned_font_data, cfg);
+              ImFont *f = addFontFile(atlas, mff, in.params, ranges, in.base_dir_abs, owned_font_data, reusable_font_data, cfg);
               (void)f;
             }
             if (body)
-              m_fonts[FontRole::Emoji] = body;
+              fonts[FontRole::Emoji] = body;
           }
 
           // Headings H1/H2/H3 (separate instances, may reuse Body TTF path with
@@ -798,9 +1119,9 @@ namespace ImGuiX::Fonts {
             return add_single(role, ff);
           };
 
-          add_headline(FontRole::H1, m_px_h1);
-          add_headline(FontRole::H2, m_px_h2);
-          add_headline(FontRole::H3, m_px_h3);
+          add_headline(FontRole::H1, in.px_h1);
+          add_headline(FontRole::H2, in.px_h2);
+          add_headline(FontRole::H3, in.px_h3);
 
           // Bold/Italic/BoldItalic/Monospace
           auto add_optional_role = [&](FontRole role) -> ImFont * {
@@ -819,91 +1140,100 @@ namespace ImGuiX::Fonts {
         if (!body) {
           FontFile fb{};
           fb.path = IMGUIX_FONTS_FALLBACK_BODY_BASENAME;
-          fb.size_px = m_px_body;
+          fb.size_px = in.px_body;
           body = add_single(FontRole::Body, fb);
 
           FontFile ic{};
           ic.path = IMGUIX_FONTS_FALLBACK_ICONS_BASENAME;
-          ic.size_px = m_px_body;
+          ic.size_px = in.px_body;
           ic.merge = true;
-          addFontFile(ic, m_params, ranges, base_dir_abs, m_owned_font_data, cfg);
+          addFontFile(atlas, ic, in.params, ranges, in.base_dir_abs, owned_font_data, reusable_font_data, cfg);
           if (body)
-            m_fonts[FontRole::Icons] = body;
+            fonts[FontRole::Icons] = body;
 
           // Headings reuse Body path with different sizes
           FontFile h{};
           h.path = fb.path;
-          h.size_px = m_px_h1;
+          h.size_px = in.px_h1;
           add_single(FontRole::H1, h);
-          h.size_px = m_px_h2;
+          h.size_px = in.px_h2;
           add_single(FontRole::H2, h);
-          h.size_px = m_px_h3;
+          h.size_px = in.px_h3;
           add_single(FontRole::H3, h);
         }
       } else {
             // --- MANUAL MODE ---
-            if (m_manual.has_body) {
+            if (in.manual.has_body) {
                 // Body root
-                body = add_single(FontRole::Body, m_manual.body);
+                body = add_single(FontRole::Body, in.manual.body);
 
                 auto do_merge_vec = [&](const std::vector<FontFile> &vec) {
                     for (auto ff : vec) {
                         ff.merge = true;
-                        (void)addFontFile(ff, m_params, ranges, base_dir_abs, m_owned_font_data, cfg);
+                        (void)addFontFile(atlas, ff, in.params, ranges, in.base_dir_abs, owned_font_data, reusable_font_data, cfg);
                     }
                 };
 
                 // Explicit roles
-                bool merged_icons = !m_manual.merges_icons.empty();
-                bool merged_emoji = !m_manual.merges_emoji.empty();
-                do_merge_vec(m_manual.merges_icons);
-                do_merge_vec(m_manual.merges_emoji);
+                bool merged_icons = !in.manual.merges_icons.empty();
+                bool merged_emoji = !in.manual.merges_emoji.empty();
+                do_merge_vec(in.manual.merges_icons);
+                do_merge_vec(in.manual.merges_emoji);
 
                 // Legacy: if old method used, include both roles
-                if (!m_manual.merges_unknown.empty()) {
-                    do_merge_vec(m_manual.merges_unknown);
+                if (!in.manual.merges_unknown.empty()) {
+                    do_merge_vec(in.manual.merges_unknown);
                     merged_icons = true;
                     merged_emoji = true;
                 }
 
                 if (body) {
                     if (merged_icons)
-                        m_fonts[FontRole::Icons] = body;
+                        fonts[FontRole::Icons] = body;
                     if (merged_emoji)
-                        m_fonts[FontRole::Emoji] = body;
+                        fonts[FontRole::Emoji] = body;
                 }
 
                 // Headlines
                 auto ensure_headline = [&](FontRole role, float px_default) {
-                    auto it = m_manual.headlines.find(role);
-                    if (it != m_manual.headlines.end()) {
+                    auto it = in.manual.headlines.find(role);
+                    if (it != in.manual.headlines.end()) {
                         add_single(role, it->second);
                     } else 
                     if (body) {
                         // reuse body path as a convenience
-                        FontFile ff = m_manual.body;
+                        FontFile ff = in.manual.body;
                         ff.size_px = px_default;
                         add_single(role, ff);
                     }
                 };
-                ensure_headline(FontRole::H1, m_px_h1);
-                ensure_headline(FontRole::H2, m_px_h2);
-                ensure_headline(FontRole::H3, m_px_h3);
+                ensure_headline(FontRole::H1, in.px_h1);
+                ensure_headline(FontRole::H2, in.px_h2);
+                ensure_headline(FontRole::H3, in.px_h3);
             } else {
-                br.message = u8"Manual mode: Body font not provided";
+                message = u8"Manual mode: Body font not provided";
             }
         }
 
 #       if IMGUIX_SUPPRESS_EMOJI_CONTROL_GLYPHS
         {
             // Важно: ДО Build(). updateBackendTexture() обычно вызывает Build() внутри.
-            ImFontAtlas* atlas = ImGui::GetIO().Fonts;
             // Можно пройтись по всем шрифтам в атласе
-            for (ImFont* f : atlas->Fonts)
-                AddInvisibleEmojiControls(atlas, f);
+            for (ImFont* f : atlas.Fonts)
+                AddInvisibleEmojiControls(&atlas, f);
         }
 #       endif
 
+        // Bake here so the result can be stored before the backend upload.
+        if (!in.bake && in.disk_cache_path.empty()) return;
+        if (atlas.Build() && !in.disk_cache_path.empty()) {
+            (void)AtlasFileCache::save(in.disk_cache_path, in.disk_key, atlas, fonts);
+        }
+    }
+
+    inline BuildResult FontManager::finishBuild(BuildResult br) {
+        ImGuiIO &io = ImGui::GetIO();
+
         // Update backend texture for active backend
         if (!updateBackendTexture()) {
             br.success = false;
@@ -915,24 +1245,122 @@ namespace ImGuiX::Fonts {
         if (ImFont *f = getFont(FontRole::Body)) {
             io.FontDefault = f;
         }
+        m_atlas = io.Fonts;
+        trimState().cooldown = 0;
 
         // Done
         br.success = true;
         br.fonts = m_fonts;
         m_dirty = false;
+        if (m_shared) {
+            m_shared->fonts = m_fonts;
+            m_shared->dirty = false;
+            m_shared->builder = this;
+            m_shared_generation = ++m_shared->generation;
+        }
         return br;
     }
 
     inline BuildResult FontManager::rebuildIfNeeded() {
-        if (!m_dirty) {
+        if (!m_dirty && m_shared) {
+            // Another owner rebuilt the atlas (adopt) or lost its texture (rebuild).
+            if (m_shared->dirty) return buildNow();
+            if (m_shared->generation != m_shared_generation) return adoptSharedAtlas();
+        }
+        // A running background rebuild picks up m_dirty when it is applied.
+        if (!m_dirty || isRebuildPending()) {
             BuildResult ok{};
             ok.success = true;
             ok.fonts = m_fonts;
             return ok;
         }
+        if (canRebuildInBackground()) return startBackgroundRebuild();
         return buildNow();
     }
 
+    /// ----------------------------
+    /// Background rebuild
+    /// ----------------------------
+
+    inline bool FontManager::canRebuildInBackground() const {
+#       if IMGUI_VERSION_NUM >= 19200 || defined(__EMSCRIPTEN__)
+        // 1.92+ rasterizes glyphs during the frame, so a rebuild has little to
+        // move off the GUI thread; Emscripten builds have no worker threads.
+        return false;
+#       elif !defined(GImGui)
+        // The worker's allocations would race on the counters of the shared
+        // global context.
+        return false;
+#       else
+        // The first build has no atlas to keep on screen; a shared atlas is
+        // bound to other contexts and is rebuilt in place.
+        return m_background_rebuild &&
+               m_atlas && m_atlas == ImGui::GetIO().Fonts &&
+               !m_shared && !(m_shared_enabled && m_atlas_cache);
+#       endif
+    }
+
+    inline BuildResult FontManager::startBackgroundRebuild() {
+        BuildInput in = makeBuildInput();
+        in.bake = true;
+        m_dirty = false;
+
+        // The worker maps its own copies of the font files: the current atlas
+        // keeps reading m_owned_font_data until the swap. GImGui is thread-local
+        // (see canRebuildInBackground()), so ImGui::MemAlloc() on the worker
+        // touches no context.
+        m_pending_build = std::async(std::launch::async, [in = std::move(in)]() {
+            PendingBuild out;
+            out.atlas.reset(IM_NEW(ImFontAtlas)());
+            FontBlobs reusable_font_data;
+            bakeAtlas(in, *out.atlas, out.font_data, reusable_font_data, out.fonts, out.message);
+            return out;
+        });
+
+        BuildResult br{};
+        br.success = true;
+        br.fonts = m_fonts;
+        return br;
+    }
+
+    inline bool FontManager::isRebuildReady() const {
+        return m_pending_build.valid() &&
+               m_pending_build.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    inline BuildResult FontManager::applyRebuild() {
+        if (!m_pending_build.valid()) {
+            BuildResult ok{};
+            ok.success = true;
+            ok.fonts = m_fonts;
+            return ok;
+        }
+        PendingBuild done = m_pending_build.get();
+        const bool dirty_again = m_dirty; // configuration changed during the build
+
+        // The context takes the new atlas and destroys the old one; the old
+        // font mappings are released after it, when `done` goes out of scope.
+        bindAtlas(done.atlas.release(), true);
+        m_owned_font_data.swap(done.font_data);
+        m_fonts = std::move(done.fonts);
+
+        BuildResult br{};
+        br.message = std::move(done.message);
+        br = finishBuild(std::move(br));
+        if (dirty_again) {
+            m_dirty = true;
+            (void)rebuildIfNeeded();
+        }
+        return br;
+    }
+
+    inline void FontManager::discardRebuild() {
+        if (!m_pending_build.valid()) return;
+        // The worker only touches its own atlas; wait for it and drop the result.
+        m_pending_build.wait();
+        m_pending_build = {};
+    }
+
     inline BuildResult FontManager::initFromJsonOrDefaults() {
         using nlohmann::json;
 #   ifdef IMGUIX_FONTS_ENABLE_JSON
@@ -3,6 +3,7 @@
 #define _IMGUIX_FONTS_FONT_TYPES_HPP_INCLUDED
 
 #include <imguix/config/fonts.hpp>
+#include <imguix/utils/mapped_file.hpp>
 
 namespace ImGuiX::Fonts {
 
@@ -41,6 +42,10 @@ namespace ImGuiX::Fonts {
         std::string ranges_preset;    ///< Optional named range preset
     };
 
+    /// \brief Font files mapped for the atlas, keyed by resolved UTF-8 path.
+    /// \details Every role that uses a file shares one read-only mapping.
+    using FontBlobs = std::unordered_map<std::string, ImGuiX::Utils::MappedFile>;
+
     /// \brief Parameters that affect atlas build and scaling.
     struct BuildParams {
         float dpi = 96.0f;     ///< Logical DPI (96 = 1.0 scale)
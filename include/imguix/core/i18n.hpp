@@ -4,21 +4,29 @@
 
 /// \file i18n.hpp
 /// \brief Central include for ImGuiX i18n components.
-/// \note Public API: ImGuiX::Utils::I18N::LangStore and ImGuiX::Utils::I18N::PluralRules.
+/// \note Public API: ImGuiX::I18N::LangStore, ImGuiX::I18N::LangCatalog and ImGuiX::I18N::PluralRules.
 /// \note LangStore searches resources relative to the executable by default.
 /// \note Override lookup roots via the macros below.
 
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <deque>
+#include <future>
+#include <set>
+#include <array>
 #include <fstream>
 #include <sstream>
 #include <utility>
 #include <stdexcept>
 #include <system_error>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include <fmt/core.h>
 #include <fmt/format.h>
@@ -26,6 +34,7 @@
 #include <filesystem>
 
 #include "i18n/PluralRules.hpp"
+#include "i18n/LangCatalog.hpp"
 #include "i18n/LangStore.hpp"
 
 #endif // _IMGUIX_CORE_I18N_I18N_HPP_INCLUDED
@@ -0,0 +1,270 @@
+#pragma once
+#ifndef _IMGUIX_CORE_I18N_LANG_CATALOG_HPP_INCLUDED
+#define _IMGUIX_CORE_I18N_LANG_CATALOG_HPP_INCLUDED
+
+#include <imguix/config/i18n.hpp>
+
+/// \file LangCatalog.hpp
+/// \brief Shared, immutable translation tables loaded once per process.
+///
+/// A LangCatalog owns the string tables of every language requested so far,
+/// the plural rules and the Markdown cache. Tables are built on first use
+/// and never change afterwards, so any number of LangStore views (one per
+/// window) can read them without copies or locks.
+///
+/// Binary catalog:
+/// - With a cache directory (IMGUIX_I18N_BINARY_CATALOG) each language is compiled
+///   into a sorted string table `<cache_dir>/<lang>.i18n.bin`. Later runs memory-map that file
+///   and binary-search it directly; JSON is parsed again only when the sources
+///   change (name, size or mtime of a `*.json` file).
+/// - A build step may ship `<base_dir>/<lang>.i18n.bin` (see LangCatalog::compile());
+///   it is mapped while it matches the sources, or as is without a JSON folder.
+///
+/// Notes:
+/// - Thread-safe: tables are published as shared_ptr<const LangTable>.
+/// - WindowInstance takes the catalog from the ResourceRegistry, so all windows
+///   of an application share one parse of the i18n directory.
+
+#include <imguix/utils/mapped_file.hpp>
+#include "PluralRules.hpp"
+
+namespace ImGuiX::I18N {
+
+    namespace fs = std::filesystem;
+
+    class LangCatalog;
+
+    /// \class LangTable
+    /// \brief Immutable sorted key -> text table of one language.
+    /// \details Entries live in one contiguous block, either memory-mapped from a
+    ///          compiled catalog file or built in memory from JSON. Keys and values
+    ///          are NUL-terminated inside the block.
+    class LangTable {
+    public:
+        LangTable() = default;
+        ~LangTable();
+
+        LangTable(const LangTable&) = delete;
+        LangTable& operator=(const LangTable&) = delete;
+
+        /// \brief Find text by key.
+        /// \param key Lookup key.
+        /// \return Pointer to stored text or nullptr.
+        /// \note The std::string is created on first access of the key and then reused.
+        const std::string* find(std::string_view key) const;
+
+        /// \brief Find text by key without allocating.
+        /// \param key Lookup key.
+        /// \return NUL-terminated view into the table; data() is nullptr if missing.
+        std::string_view find_view(std::string_view key) const noexcept;
+
+        /// \brief Find the plural form "<base_key>.<category>".
+        /// \param base_key Base key without the category suffix.
+        /// \param cat CLDR category.
+        /// \return Pointer to stored text or nullptr.
+        /// \note One hash lookup into an index built when the table is loaded.
+        const std::string* find_plural(std::string_view base_key, PluralCategory cat) const;
+
+        /// \brief Stable copy of \p key owned by the table.
+        /// \return View that lives as long as the table; data() is nullptr if missing.
+        std::string_view key_view(std::string_view key) const noexcept;
+
+        /// \brief Number of entries.
+        std::size_t size() const noexcept { return m_count; }
+
+        /// \brief True if the table is backed by a memory-mapped catalog file.
+        bool is_mapped() const noexcept { return m_file.is_open(); }
+
+    private:
+        friend class LangCatalog;
+
+        static constexpr std::uint32_t kMagic   = 0x434c5849u; ///< "IXLC"
+        static constexpr std::uint32_t kVersion = 1;
+
+        /// \brief File header; followed by Entry[count] and the string block.
+        struct Header {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t fingerprint; ///< Hash of the JSON sources; 0 if unknown.
+            std::uint32_t count;
+            std::uint32_t reserved;
+        };
+
+        /// \brief Offsets are relative to the string block.
+        struct Entry {
+            std::uint32_t key_off;
+            std::uint32_t key_len;
+            std::uint32_t val_off;
+            std::uint32_t val_len;
+        };
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+        static constexpr std::uint32_t kNoForm = static_cast<std::uint32_t>(-1);
+
+        /// \brief Entry index of each plural category of one base key.
+        using PluralForms = std::array<std::uint32_t, static_cast<std::size_t>(PluralCategory::Count)>;
+
+        /// \brief Point the table at a serialized block.
+        /// \return False if the block is truncated or malformed.
+        bool attach(const unsigned char* data, std::size_t size);
+
+        std::size_t index_of(std::string_view key) const noexcept;
+
+        std::string_view key_at(std::size_t i) const noexcept {
+            return {m_blob + m_entries[i].key_off, m_entries[i].key_len};
+        }
+
+        std::string_view value_at(std::size_t i) const noexcept {
+            return {m_blob + m_entries[i].val_off, m_entries[i].val_len};
+        }
+
+        /// \brief std::string of entry \p i, created on first use.
+        const std::string* string_at(std::size_t i) const;
+
+        /// \brief Group "<base>.<category>" keys by base.
+        void build_plural_index();
+
+        Utils::MappedFile m_file;          ///< Mapped catalog file, if any.
+        std::vector<unsigned char> m_bytes; ///< In-memory block otherwise.
+        std::uint64_t m_fingerprint{0};
+        const Entry* m_entries{nullptr};
+        const char*  m_blob{nullptr};
+        std::size_t  m_count{0};
+        std::unique_ptr<std::atomic<const std::string*>[]> m_strings; ///< Lazily created find() results.
+        std::unordered_map<std::string_view, PluralForms> m_plural_forms; ///< base key -> forms; keys view the block.
+    };
+
+    /// \class LangCatalog
+    /// \brief Process-wide set of translation tables shared by LangStore views.
+    class LangCatalog : public std::enable_shared_from_this<LangCatalog> {
+    public:
+
+        using TableFuture = std::shared_future<std::shared_ptr<const LangTable>>;
+
+        /// \brief Construct catalog with default directory and English fallback.
+        /// \note Starts loading IMGUIX_I18N_PRELOAD_LANGUAGES in the background.
+        LangCatalog()
+            : LangCatalog(default_i18n_base_dir(), u8"en") {
+            preload_all(configured_preload_languages());
+        }
+
+        /// \brief Construct catalog and load the default language.
+        /// \param base_dir Root folder with per-language subfolders.
+        /// \param default_lang Default language (fallback), typically "en".
+        /// \param cache_dir Folder of catalogs compiled at run time; empty disables
+        ///        compiling them (shipped catalogs are still mapped).
+        explicit LangCatalog(std::string base_dir,
+                             std::string default_lang = u8"en",
+                             std::string cache_dir = default_i18n_cache_dir());
+
+        /// \brief Wait for background loads started by preload().
+        ~LangCatalog();
+
+        LangCatalog(const LangCatalog&) = delete;
+        LangCatalog& operator=(const LangCatalog&) = delete;
+
+        /// \brief Root folder of the translations.
+        const std::string& base_dir() const noexcept { return m_base_dir; }
+
+        /// \brief Default (fallback) language code.
+        const std::string& default_language() const noexcept { return m_default_lang; }
+
+        /// \brief Get the table of a language, loading it on first request.
+        /// \param lang Language code.
+        /// \return Shared table; empty when the language folder is missing.
+        std::shared_ptr<const LangTable> table(const std::string& lang) const;
+
+        /// \brief Start loading a language on a background thread.
+        /// \param lang Language code.
+        /// \return Future of the table; ready at once if already loaded.
+        /// \note Repeated calls share one load. table() waits for a load in flight.
+        ///       On Emscripten the language is loaded on the calling thread.
+        TableFuture preload(const std::string& lang) const;
+
+        /// \brief Preload several languages in parallel.
+        /// \param langs Language codes.
+        void preload_all(const std::vector<std::string>& langs) const;
+
+        /// \brief Get a loaded table without waiting.
+        /// \param lang Language code.
+        /// \return Table, or nullptr if it was not loaded yet.
+        std::shared_ptr<const LangTable> try_table(const std::string& lang) const;
+
+        /// \brief Languages listed in IMGUIX_I18N_PRELOAD_LANGUAGES.
+        static std::vector<std::string> configured_preload_languages();
+
+        /// \brief Table of the default language.
+        const std::shared_ptr<const LangTable>& default_table() const noexcept { return m_default_table; }
+
+        /// \brief Plural rules loaded from <base_dir>/plurals.json, with built-ins.
+        const std::shared_ptr<const PluralRules>& plural_rules() const noexcept { return m_plural_rules; }
+
+        /// \brief Load Markdown content for a document, cached per language.
+        /// \param lang Language code.
+        /// \param doc_key Document key.
+        /// \return Markdown content or empty string if missing.
+        std::string doc(const std::string& lang, std::string_view doc_key) const;
+
+        /// \brief Resolve the default i18n directory from configuration.
+        static std::string default_i18n_base_dir();
+
+        /// \brief Resolve the default cache directory of compiled catalogs.
+        /// \return Empty when IMGUIX_I18N_BINARY_CATALOG is 0.
+        static std::string default_i18n_cache_dir();
+
+        /// \brief Compile the JSON files of a language into its catalog file.
+        /// \param base_dir Root folder with per-language subfolders.
+        /// \param lang Language code.
+        /// \return True if `<base_dir>/<lang>.i18n.bin` was written.
+        /// \note Meant for build steps; catalogs also compile themselves on first run.
+        static bool compile(const std::string& base_dir, const std::string& lang);
+
+        /// \brief Path of the compiled catalog of a language.
+        static fs::path catalog_path(const std::string& base_dir, const std::string& lang);
+
+    private:
+
+        using Entries = std::vector<std::pair<std::string, std::string>>;
+
+        std::shared_ptr<LangTable> load_language_table(const std::string& lang) const;
+
+        /// \brief List the JSON sources of a language and hash their metadata.
+        /// \return Fingerprint; 0 when there are no sources.
+        static std::uint64_t collect_sources(
+                const fs::path& dir,
+                std::vector<fs::path>& files
+            );
+
+        static Entries parse_sources(const std::vector<fs::path>& files, const std::string& lang);
+
+        static void merge_object_for_lang(
+                const nlohmann::json& obj,
+                const std::string& lang,
+                Entries& out,
+                std::unordered_set<std::string>& seen
+            );
+
+        /// \brief Serialize entries into a sorted catalog block.
+        static std::vector<unsigned char> serialize(Entries entries, std::uint64_t fingerprint);
+
+        static std::string read_file(const std::string& path);
+
+        std::string m_base_dir;
+        std::string m_cache_dir;
+        std::string m_default_lang;
+        std::shared_ptr<const LangTable>   m_default_table;
+        std::shared_ptr<const PluralRules> m_plural_rules;
+
+        mutable std::mutex m_mutex; ///< Guards the caches below.
+        mutable std::unordered_map<std::string, std::shared_ptr<const LangTable>> m_tables; // lang -> table
+        mutable std::unordered_map<std::string, std::string> m_md_cache; // (lang + '\n' + key) -> content
+        mutable std::unordered_map<std::string, TableFuture> m_loading; // lang -> background load
+    };
+
+} // namespace ImGuiX::I18N
+
+#ifdef IMGUIX_HEADER_ONLY
+#   include "LangCatalog.ipp"
+#endif
+
+#endif // _IMGUIX_CORE_I18N_LANG_CATALOG_HPP_INCLUDED
@@ -0,0 +1,437 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <nlohmann/json.hpp>
+
+#include <imguix/utils/atomic_write.hpp>
+#include <imguix/utils/fnv1a.hpp>
+#include <imguix/utils/path_utils.hpp>
+#include <imguix/utils/strip_json_comments.hpp>
+#include <imguix/core/i18n/PluralRules.hpp>
+
+namespace ImGuiX::I18N {
+
+    LangTable::~LangTable() {
+        if (!m_strings) return;
+        for (std::size_t i = 0; i < m_count; ++i) {
+            delete m_strings[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    const std::string* LangTable::find(std::string_view key) const {
+        const std::size_t i = index_of(key);
+        return (i == npos) ? nullptr : string_at(i);
+    }
+
+    const std::string* LangTable::find_plural(std::string_view base_key, PluralCategory cat) const {
+        const auto c = static_cast<std::size_t>(cat);
+        if (c >= static_cast<std::size_t>(PluralCategory::Count)) return nullptr;
+        auto it = m_plural_forms.find(base_key);
+        if (it == m_plural_forms.end() || it->second[c] == kNoForm) return nullptr;
+        return string_at(it->second[c]);
+    }
+
+    std::string_view LangTable::key_view(std::string_view key) const noexcept {
+        const std::size_t i = index_of(key);
+        return (i == npos) ? std::string_view{} : key_at(i);
+    }
+
+    const std::string* LangTable::string_at(std::size_t i) const {
+        const std::string* s = m_strings[i].load(std::memory_order_acquire);
+        if (s) return s;
+        // First access of this key: publish a string; a racing thread's copy wins or is dropped.
+        auto* created = new std::string(value_at(i));
+        if (m_strings[i].compare_exchange_strong(s, created, std::memory_order_acq_rel)) {
+            return created;
+        }
+        delete created;
+        return s;
+    }
+
+    std::string_view LangTable::find_view(std::string_view key) const noexcept {
+        const std::size_t i = index_of(key);
+        return (i == npos) ? std::string_view{} : value_at(i);
+    }
+
+    std::size_t LangTable::index_of(std::string_view key) const noexcept {
+        std::size_t lo = 0;
+        std::size_t hi = m_count;
+        while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            const int cmp = key_at(mid).compare(key);
+            if (cmp == 0) return mid;
+            if (cmp < 0) lo = mid + 1;
+            else hi = mid;
+        }
+        return npos;
+    }
+
+    bool LangTable::attach(const unsigned char* data, std::size_t size) {
+        Header header{};
+        if (!data || size < sizeof(Header)) return false;
+        std::memcpy(&header, data, sizeof(Header));
+        if (header.magic != kMagic || header.version != kVersion) return false;
+        const std::size_t entries_size = static_cast<std::size_t>(header.count) * sizeof(Entry);
+        if (entries_size > size - sizeof(Header)) return false;
+
+        const auto* entries = reinterpret_cast<const Entry*>(data + sizeof(Header));
+        const char* blob = reinterpret_cast<const char*>(data + sizeof(Header) + entries_size);
+        const std::size_t blob_size = size - sizeof(Header) - entries_size;
+        auto terminated = [&](std::uint32_t off, std::uint32_t len) {
+            return static_cast<std::size_t>(off) + len < blob_size && blob[off + len] == '\0';
+        };
+        // Validate once so lookups can trust the offsets and the sort order.
+        for (std::size_t i = 0; i < header.count; ++i) {
+            const Entry& e = entries[i];
+            if (!terminated(e.key_off, e.key_len) || !terminated(e.val_off, e.val_len)) return false;
+            if (i > 0) {
+                const Entry& p = entries[i - 1];
+                if (std::string_view(blob + p.key_off, p.key_len) >= std::string_view(blob + e.key_off, e.key_len)) {
+                    return false;
+                }
+            }
+        }
+
+        m_fingerprint = header.fingerprint;
+        m_entries = entries;
+        m_blob = blob;
+        m_count = header.count;
+        m_strings.reset(new std::atomic<const std::string*>[m_count]());
+        build_plural_index();
+        return true;
+    }
+
+    void LangTable::build_plural_index() {
+        PluralForms none;
+        none.fill(kNoForm);
+        for (std::size_t i = 0; i < m_count; ++i) {
+            const std::string_view key = key_at(i);
+            const std::size_t dot = key.rfind('.');
+            if (dot == std::string_view::npos) continue;
+            const PluralCategory cat = plural_category_from_name(key.substr(dot + 1));
+            if (cat == PluralCategory::Count) continue;
+            auto it = m_plural_forms.try_emplace(key.substr(0, dot), none).first;
+            it->second[static_cast<std::size_t>(cat)] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    LangCatalog::LangCatalog(std::string base_dir, std::string default_lang, std::string cache_dir)
+        : m_base_dir(std::move(base_dir)),
+          m_cache_dir(std::move(cache_dir)),
+          m_default_lang(std::move(default_lang)) {
+        // Load fallback language (default) once.
+        m_default_table = load_language_table(m_default_lang);
+        m_tables.emplace(m_default_lang, m_default_table);
+
+        // Try optional plurals.json in <base_dir>/plurals.json (ignore if absent).
+        auto rules = std::make_shared<PluralRules>(); // always present; has built-ins
+        std::error_code ec;
+        const fs::path path = fs::u8path(m_base_dir) / IMGUIX_I18N_PLURALS_FILENAME;
+        if (fs::exists(path, ec)) {
+            (void)rules->load_from_file(path.u8string()); // ignore failure
+        }
+        m_plural_rules = std::move(rules);
+    }
+
+    LangCatalog::~LangCatalog() {
+        // Background loads use this object; finish them before members go away.
+        std::unordered_map<std::string, TableFuture> loading;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            loading.swap(m_loading);
+        }
+        for (auto& entry : loading) entry.second.wait();
+    }
+
+    std::shared_ptr<const LangTable> LangCatalog::table(const std::string& lang) const {
+        TableFuture pending;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (auto it = m_tables.find(lang); it != m_tables.end()) return it->second;
+            if (auto it = m_loading.find(lang); it != m_loading.end()) pending = it->second;
+        }
+        if (pending.valid()) return pending.get();
+        // Parse outside the lock; if two threads race, the first table wins.
+        std::shared_ptr<const LangTable> loaded = load_language_table(lang);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tables.emplace(lang, std::move(loaded)).first->second;
+    }
+
+    LangCatalog::TableFuture LangCatalog::preload(const std::string& lang) const {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (auto it = m_tables.find(lang); it != m_tables.end()) {
+            std::promise<std::shared_ptr<const LangTable>> ready;
+            ready.set_value(it->second);
+            return ready.get_future().share();
+        }
+        if (auto it = m_loading.find(lang); it != m_loading.end()) return it->second;
+
+        auto load = [this, lang]() -> std::shared_ptr<const LangTable> {
+            std::shared_ptr<const LangTable> loaded = load_language_table(lang);
+            std::lock_guard<std::mutex> guard(m_mutex);
+            return m_tables.emplace(lang, std::move(loaded)).first->second;
+        };
+#if defined(__EMSCRIPTEN__)
+        TableFuture future = std::async(std::launch::deferred, std::move(load)).share();
+#else
+        TableFuture future = std::async(std::launch::async, std::move(load)).share();
+#endif
+        m_loading.emplace(lang, future);
+        lock.unlock();
+#if defined(__EMSCRIPTEN__)
+        future.wait(); // no worker threads; load now
+#endif
+        return future;
+    }
+
+    void LangCatalog::preload_all(const std::vector<std::string>& langs) const {
+        for (const auto& lang : langs) {
+            if (!lang.empty()) (void)preload(lang);
+        }
+    }
+
+    std::shared_ptr<const LangTable> LangCatalog::try_table(const std::string& lang) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tables.find(lang);
+        return (it == m_tables.end()) ? nullptr : it->second;
+    }
+
+    std::vector<std::string> LangCatalog::configured_preload_languages() {
+        std::vector<std::string> out;
+        const std::string list = IMGUIX_I18N_PRELOAD_LANGUAGES;
+        std::size_t start = 0;
+        while (start <= list.size()) {
+            std::size_t end = list.find(',', start);
+            if (end == std::string::npos) end = list.size();
+            std::string lang = list.substr(start, end - start);
+            lang.erase(0, lang.find_first_not_of(" \t"));
+            lang.erase(lang.find_last_not_of(" \t") + 1);
+            if (!lang.empty()) out.push_back(std::move(lang));
+            start = end + 1;
+        }
+        return out;
+    }
+
+    std::string LangCatalog::doc(const std::string& lang, std::string_view doc_key) const {
+        std::string cache_key;
+        cache_key.reserve(lang.size() + 1 + doc_key.size());
+        cache_key += lang;
+        cache_key += '\n';
+        cache_key.append(doc_key.begin(), doc_key.end());
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (auto it = m_md_cache.find(cache_key); it != m_md_cache.end()) return it->second;
+        }
+
+        const fs::path p = fs::path(m_base_dir) / lang / (std::string(doc_key) + u8".md");
+        auto s = read_file(p.string());
+        if (!s.empty()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_md_cache.emplace(std::move(cache_key), s);
+        }
+        return s;
+    }
+
+    std::string LangCatalog::default_i18n_base_dir() {
+#if IMGUIX_RESOLVE_PATHS_REL_TO_EXE
+        return ImGuiX::Utils::resolveExecPath(IMGUIX_I18N_DIR);
+#else
+        return std::string(IMGUIX_I18N_DIR);
+#endif
+    }
+
+    std::string LangCatalog::default_i18n_cache_dir() {
+#if !IMGUIX_I18N_BINARY_CATALOG
+        return {};
+#elif IMGUIX_RESOLVE_PATHS_REL_TO_EXE
+        return ImGuiX::Utils::resolveExecPath(IMGUIX_I18N_CACHE_DIR);
+#else
+        return std::string(IMGUIX_I18N_CACHE_DIR);
+#endif
+    }
+
+    bool LangCatalog::compile(const std::string& base_dir, const std::string& lang) {
+        std::vector<fs::path> files;
+        const std::uint64_t fingerprint = collect_sources(fs::u8path(base_dir) / lang, files);
+        if (files.empty()) return false;
+        const std::vector<unsigned char> bytes = serialize(parse_sources(files, lang), fingerprint);
+        return Utils::writeFileAtomic(catalog_path(base_dir, lang), bytes.data(), bytes.size());
+    }
+
+    fs::path LangCatalog::catalog_path(const std::string& base_dir, const std::string& lang) {
+        return fs::u8path(base_dir) / fs::u8path(lang + u8".i18n.bin");
+    }
+
+    std::shared_ptr<LangTable> LangCatalog::load_language_table(const std::string& lang) const {
+        std::vector<fs::path> files;
+        const std::uint64_t fingerprint = collect_sources(fs::u8path(m_base_dir) / lang, files);
+
+        // Shipped catalog first, then the one compiled by an earlier run.
+        std::vector<fs::path> catalogs{catalog_path(m_base_dir, lang)};
+        const bool cache = !m_cache_dir.empty();
+        if (cache) catalogs.push_back(catalog_path(m_cache_dir, lang));
+        for (const auto& bin : catalogs) {
+            auto mapped = std::make_shared<LangTable>();
+            if (mapped->m_file.open(bin) &&
+                mapped->attach(mapped->m_file.data(), mapped->m_file.size()) &&
+                (files.empty() || mapped->m_fingerprint == fingerprint)) {
+                return mapped; // no JSON parsing
+            }
+        }
+
+        auto out = std::make_shared<LangTable>();
+        if (files.empty()) return out; // allowed to be empty
+
+        out->m_bytes = serialize(parse_sources(files, lang), fingerprint);
+        if (cache) { // next run maps it
+            (void)Utils::writeFileAtomic(catalogs.back(), out->m_bytes.data(), out->m_bytes.size());
+        }
+        out->attach(out->m_bytes.data(), out->m_bytes.size());
+        return out;
+    }
+
+    std::uint64_t LangCatalog::collect_sources(const fs::path& dir, std::vector<fs::path>& files) {
+        files.clear();
+        std::error_code ec;
+        if (!fs::exists(dir, ec) || !fs::is_directory(dir, ec)) return 0;
+
+        for (auto& de : fs::directory_iterator(dir, ec)) {
+            if (ec) break;
+            if (!de.is_regular_file()) continue;
+            if (de.path().extension() != u8".json") continue;
+            files.push_back(de.path());
+        }
+        // Fixed order: merge results and the fingerprint do not depend on the OS.
+        std::sort(files.begin(), files.end());
+
+        // FNV-1a over name, size and mtime of every source.
+        Utils::Fnv1a hash;
+        for (const auto& p : files) {
+            const std::string name = p.filename().u8string();
+            const auto size = static_cast<std::uint64_t>(fs::file_size(p, ec));
+            const auto mtime = static_cast<std::int64_t>(fs::last_write_time(p, ec).time_since_epoch().count());
+            hash.add(name.data(), name.size());
+            hash.addPod(size);
+            hash.addPod(mtime);
+        }
+        return files.empty() ? 0 : (hash.value() | 1); // never 0
+    }
+
+    LangCatalog::Entries LangCatalog::parse_sources(
+            const std::vector<fs::path>& files,
+            const std::string& lang) {
+        Entries out;
+        std::unordered_set<std::string> seen;
+        for (const auto& p : files) {
+            const std::string raw = read_file(p.string());
+            if (raw.empty()) continue;
+
+            const std::string clean = ImGuiX::Utils::strip_json_comments(raw, /*with_whitespace*/ false);
+
+            nlohmann::json j;
+            try {
+                j = nlohmann::json::parse(clean);
+            } catch (...) {
+                // ignore broken files (could log)
+                continue;
+            }
+
+            merge_object_for_lang(j, lang, out, seen);
+        }
+        return out;
+    }
+
+    void LangCatalog::merge_object_for_lang(
+            const nlohmann::json& obj,
+            const std::string& lang,
+            Entries& out,
+            std::unordered_set<std::string>& seen
+        ) {
+        if (!obj.is_object()) return;
+
+        auto get_sv = [](const nlohmann::json& j) -> std::string {
+            if (j.is_string()) return j.get<std::string>();
+            if (j.is_array()) {
+                std::string s;
+                for (const auto& e : j) if (e.is_string()) s += e.get<std::string>();
+                return s;
+            }
+            return {};
+        };
+
+        auto put = [&](const std::string& key, std::string s) {
+            if (s.empty() || !seen.insert(key).second) return; // first file wins
+            out.emplace_back(key, std::move(s));
+        };
+
+        for (auto it = obj.begin(); it != obj.end(); ++it) {
+            const nlohmann::json& val = it.value();
+
+            if (val.is_object()) {
+                if (auto jt = val.find(lang); jt != val.end()) {
+                    auto s = get_sv(*jt);
+                    if (!s.empty()) { put(it.key(), std::move(s)); continue; }
+                }
+                if (auto jt = val.find(u8"en"); jt != val.end()) {
+                    put(it.key(), get_sv(*jt));
+                }
+            } else {
+                put(it.key(), get_sv(val));
+            }
+        }
+    }
+
+    std::vector<unsigned char> LangCatalog::serialize(Entries entries, std::uint64_t fingerprint) {
+        std::sort(entries.begin(), entries.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::vector<LangTable::Entry> index;
+        index.reserve(entries.size());
+        std::string blob;
+        for (const auto& [key, value] : entries) {
+            LangTable::Entry e{};
+            e.key_off = static_cast<std::uint32_t>(blob.size());
+            e.key_len = static_cast<std::uint32_t>(key.size());
+            blob += key;
+            blob += '\0';
+            e.val_off = static_cast<std::uint32_t>(blob.size());
+            e.val_len = static_cast<std::uint32_t>(value.size());
+            blob += value;
+            blob += '\0';
+            index.push_back(e);
+        }
+
+        LangTable::Header header{};
+        header.magic = LangTable::kMagic;
+        header.version = LangTable::kVersion;
+        header.fingerprint = fingerprint;
+        header.count = static_cast<std::uint32_t>(index.size());
+
+        const std::size_t index_size = index.size() * sizeof(LangTable::Entry);
+        std::vector<unsigned char> out(sizeof(header) + index_size + blob.size());
+        std::memcpy(out.data(), &header, sizeof(header));
+        if (index_size) std::memcpy(out.data() + sizeof(header), index.data(), index_size);
+        if (!blob.empty()) std::memcpy(out.data() + sizeof(header) + index_size, blob.data(), blob.size());
+        return out;
+    }
+
+    std::string LangCatalog::read_file(const std::string& path) {
+        std::ifstream ifs(path, std::ios::binary);
+        if (!ifs) return {};
+        std::ostringstream oss; oss << ifs.rdbuf();
+        return oss.str();
+    }
+
+} // namespace ImGuiX::I18N
@@ -3,6 +3,7 @@
 #define _IMGUIX_UTILS_I18N_LANG_STORE_HPP_INCLUDED
 
 #include <imguix/config/i18n.hpp>
+#include "LangCatalog.hpp"
 
 /// \file LangStore.hpp
 /// \brief Localized strings and markdown loader with JSON (monolingual + polyglot) support,
@@ -25,7 +26,10 @@
 ///   <base_dir>/plurals.json    (optional; plural rules)
 ///
 /// Notes:
-/// - Not thread-safe by design; guard externally if needed.
+/// - A LangStore is a per-window view over a shared LangCatalog: it keeps the
+///   current language, its table pointers and the label cache; string tables,
+///   plural rules and Markdown live in the catalog.
+/// - Not thread-safe by design; guard externally if needed (the catalog is).
 /// - All caches are invalidated on language switch.
 
 namespace ImGuiX::I18N {
@@ -38,15 +42,24 @@ namespace ImGuiX::I18N {
     public:
 
         /// \brief Construct store with default directory and English fallback.
+        /// \note Creates a private catalog; windows share one through the registry.
         LangStore()
-            : LangStore(default_i18n_base_dir(), u8"en") {
+            : LangStore(LangCatalog::default_i18n_base_dir(), u8"en") {
         }
 
-        /// \brief Construct i18n store.
+        /// \brief Construct i18n store with a private catalog.
         /// \param base_dir Root folder with per-language subfolders (e.g., "<root>/en/", "<root>/ru/").
         /// \param default_lang Default language (fallback), typically "en".
         explicit LangStore(std::string base_dir, std::string default_lang = u8"en");
 
+        /// \brief Construct a view over a shared catalog.
+        /// \param catalog Shared translations; must not be null.
+        /// \note Does not parse anything; starts in the catalog's default language.
+        explicit LangStore(std::shared_ptr<const LangCatalog> catalog);
+
+        /// \brief Shared catalog backing this view.
+        const std::shared_ptr<const LangCatalog>& catalog() const noexcept { return m_catalog; }
+
         /// \brief Change current language and rebuild caches.
         /// \param lang New language code (e.g., "ru", "en").
         void set_language(std::string lang);
@@ -55,8 +68,30 @@ namespace ImGuiX::I18N {
         /// \return Active language code.
         const std::string& language() const noexcept { return m_current_lang; }
 
+        /// \brief Start loading a language on a background thread.
+        /// \param lang Language code.
+        void preload(const std::string& lang) const { (void)m_catalog->preload(lang); }
+
+        /// \brief True if switching to \p lang would not load anything.
+        bool is_language_ready(const std::string& lang) const {
+            return lang == m_catalog->default_language() || m_catalog->try_table(lang) != nullptr;
+        }
+
+        /// \brief Switch language once it has been loaded in the background.
+        /// \param lang New language code.
+        /// \note Starts a preload; the switch happens in poll_language().
+        void set_language_async(std::string lang);
+
+        /// \brief Apply a pending set_language_async() if its table is ready.
+        /// \return True if the language changed. Never blocks; call once per frame.
+        bool poll_language();
+
+        /// \brief Language requested by set_language_async(), or empty.
+        const std::string& pending_language() const noexcept { return m_pending_lang; }
+
         /// \brief Set external plural rules implementation.
         /// \param rules New rules instance; takes ownership.
+        /// \note Affects this view only.
         void set_plural_rules(std::unique_ptr<PluralRules> rules) {
             if (rules) m_plural_rules = std::move(rules);
         }
@@ -64,6 +99,7 @@ namespace ImGuiX::I18N {
         /// \brief Load plural rules from a JSON file.
         /// \param path Path to JSON file.
         /// \return True on success.
+        /// \note Extends a copy of the current rules; affects this view only.
         bool load_plural_rules_from_file(const std::string& path);
 
         /// \brief Plain localized text for a key with fallback to default language.
@@ -71,6 +107,11 @@ namespace ImGuiX::I18N {
         /// \return Reference to internal storage; invalidated on language switch or map reload.
         const std::string& text(std::string_view key) const;
 
+        /// \brief Localized text as a view into the shared table; never allocates.
+        /// \param key Lookup key.
+        /// \return NUL-terminated view; "##null" if missing. Invalidated with the table.
+        std::string_view text_view(std::string_view key) const noexcept;
+
         /// \brief Format using a compile-time checked string.
         /// \tparam Args Format arguments.
         /// \param fmt_str Format string.
@@ -110,10 +151,9 @@ namespace ImGuiX::I18N {
         /// \note Resolves: <base>/<lang>/<key>.md then <base>/<default>/<key>.md.
         std::string doc(std::string_view doc_key) const;
 
-        /// \brief Clear all runtime caches (labels and markdown).
+        /// \brief Clear per-view runtime caches (labels).
         void clear_caches() {
             m_label_cache.clear();
-            m_md_cache.clear();
         }
 
         // ------------------ Pluralization API ------------------
@@ -123,12 +163,19 @@ namespace ImGuiX::I18N {
         /// \return "one", "few", "many", "other", etc., depending on the active language.
         std::string plural_suffix(long long n) const;
 
+        /// \brief Plural category for \p n in the active language; never allocates.
+        /// \param n Numeric value.
+        /// \return Category, or PluralCategory::Count for a non-CLDR category from plurals.json.
+        PluralCategory plural_category(long long n) const;
+
         /// \brief Get pluralized text for base key and number.
         /// \param base_key Base lookup key.
         /// \param n Numeric value.
         /// \return Matching localized string.
         /// \note Fallback order: "<key>.<suffix>" (current), "<key>.<suffix>" (default),
         ///       "<key>" (current), "<key>" (default).
+        /// \note Plural forms are indexed when a language loads, so a lookup is one
+        ///       hash probe and does not allocate once the text was read before.
         const std::string& text_plural(std::string_view base_key, long long n) const;
 
         /// \brief Format pluralized text for base key and number.
@@ -155,49 +202,18 @@ namespace ImGuiX::I18N {
             bool operator()(KeyView a, KeyView b) const noexcept { return a == b; }
         };
 
-        using StrMap = std::unordered_map<KeyView, std::string, SvHash, SvEq>;
-
-        mutable std::deque<std::string> m_key_pool; ///< Key pool (owns storage so KeyView stays stable)
+        /// \brief Storage of label keys missing from both tables; deduplicated.
+        mutable std::set<std::string, std::less<>> m_key_pool;
 
         // Intern a key to guarantee stable storage
-        KeyView intern_key(const std::string& s) const {
-            m_key_pool.emplace_back(s);
-            return KeyView{m_key_pool.back()};
+        KeyView intern_key(KeyView s) const {
+            auto it = m_key_pool.find(s);
+            if (it == m_key_pool.end()) it = m_key_pool.emplace(s).first;
+            return KeyView{*it};
         }
 
-        KeyView intern_key(std::string&& s) const {
-            m_key_pool.emplace_back(std::move(s));
-            return KeyView{m_key_pool.back()};
-        }
-
-        static std::string default_i18n_base_dir();
-
-        // ---------- JSON loading ----------
-
-        StrMap load_language_map(const std::string& lang) const;
-
-        static void merge_object_for_lang(
-                const nlohmann::json& obj,
-                const std::string& lang,
-                StrMap& out,
-                const LangStore& self
-            );
-
-        static std::string get_string_or_join_array(const nlohmann::json& j);
-
-        static std::string read_file(const std::string& path);
-
-        // ---------- Markdown loading (lazy) ----------
-
-        std::string load_md_cached(const std::string& lang, std::string_view doc_key) const;
-
         // ---------- Helpers ----------
 
-        static const std::string* find_in(const StrMap& m, std::string_view key) {
-            auto it = m.find(key);
-            return (it == m.end()) ? nullptr : &it->second;
-        }
-
         static const std::string& missing_string() {
             static const std::string k = u8"##null";
             return k;
@@ -214,24 +230,17 @@ namespace ImGuiX::I18N {
 
         static std::string default_plural_suffix(const std::string& lang, long long n);
 
-        void try_load_plural_rules_from_default_location();
+        // shared data
+        std::shared_ptr<const LangCatalog> m_catalog;
+        std::shared_ptr<const LangTable>   m_default_table; ///< Fallback language table.
+        std::shared_ptr<const LangTable>   m_current_table; ///< Active language table.
+        std::shared_ptr<const PluralRules> m_plural_rules;
 
-        // config
-        std::string m_base_dir;
-        std::string m_default_lang;
         std::string m_current_lang;
-
-        // string maps
-        StrMap      m_en_map;
-        StrMap*     m_current_map{ &m_en_map };
+        std::string m_pending_lang; ///< Target of set_language_async().
 
         // caches
-        mutable std::unordered_map<std::string, StrMap>        m_lang_cache;   // lang -> map
-        //mutable std::unordered_map<std::string, std::string>   m_md_cache;     // (lang+'\n'+key) -> content
         mutable std::unordered_map<KeyView, std::string, SvHash, SvEq> m_label_cache; // key -> "text##key"
-        mutable std::unordered_map<std::string, std::unordered_map<KeyView, std::string, SvHash, SvEq>> m_md_cache; // nested map: lang -> (doc_key -> markdown content)
-        // plural rules
-        std::unique_ptr<PluralRules> m_plural_rules;
     };
 
     // -------------------- Optional: tiny plural facade --------------------
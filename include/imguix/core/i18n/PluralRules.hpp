@@ -10,6 +10,24 @@ namespace ImGuiX::I18N {
 
     namespace fs = std::filesystem;
 
+    /// \brief CLDR plural categories; usable as an array index.
+    enum class PluralCategory : std::uint8_t {
+        Zero,
+        One,
+        Two,
+        Few,
+        Many,
+        Other,
+        Count ///< Number of categories; also "not a CLDR category".
+    };
+
+    /// \brief Category name ("zero", "one", ...), or "" for Count.
+    const char* plural_category_name(PluralCategory cat) noexcept;
+
+    /// \brief Parse a category name.
+    /// \return Category, or PluralCategory::Count if \p name is not a CLDR category.
+    PluralCategory plural_category_from_name(std::string_view name) noexcept;
+
     /// \class PluralRules
     /// \brief Runtime-pluggable pluralization rules with JSON loading.
     class PluralRules {
@@ -26,11 +44,24 @@ namespace ImGuiX::I18N {
         /// \note Built-in fallback supports English (one/other) and Russian (one/few/many/other).
         std::string category(const std::string& lang, long long n) const;
 
+        /// \brief Determine plural category without allocating.
+        /// \param lang Language code.
+        /// \param n Numeric value.
+        /// \return Category; PluralCategory::Count if a loaded rule names a
+        ///         non-CLDR category (use category() for its name).
+        PluralCategory category_id(const std::string& lang, long long n) const;
+
     private:
         struct Rule {
             std::string category;
+            PluralCategory id{PluralCategory::Count}; // parsed category
             nlohmann::json cond; // condition object
         };
+
+        /// \brief First matching loaded rule of \p lang, or nullptr.
+        const Rule* match(const std::string& lang, long long n) const;
+
+        static PluralCategory builtin_category(const std::string& lang, long long n) noexcept;
         struct LangRules {
             std::vector<Rule> rules;
         };
@@ -10,6 +10,24 @@
 
 namespace ImGuiX::I18N {
 
+    namespace detail {
+        constexpr const char* kPluralCategoryNames[] = {
+            u8"zero", u8"one", u8"two", u8"few", u8"many", u8"other"
+        };
+    } // namespace detail
+
+    const char* plural_category_name(PluralCategory cat) noexcept {
+        const auto i = static_cast<std::size_t>(cat);
+        return i < static_cast<std::size_t>(PluralCategory::Count) ? detail::kPluralCategoryNames[i] : "";
+    }
+
+    PluralCategory plural_category_from_name(std::string_view name) noexcept {
+        for (std::size_t i = 0; i < static_cast<std::size_t>(PluralCategory::Count); ++i) {
+            if (name == detail::kPluralCategoryNames[i]) return static_cast<PluralCategory>(i);
+        }
+        return PluralCategory::Count;
+    }
+
     bool PluralRules::load_from_file(const std::string& path) {
         std::error_code ec;
         if (!fs::exists(path, ec)) return false;
@@ -34,6 +52,7 @@ namespace ImGuiX::I18N {
                 if (!r.contains(u8"cat") || !r[u8"cat"].is_string()) continue;
                 Rule rule;
                 rule.category = r[u8"cat"].get<std::string>();
+                rule.id = plural_category_from_name(rule.category);
                 rule.cond = r; // keep entire object; evaluator will inspect keys
                 lr.rules.emplace_back(std::move(rule));
             }
@@ -46,23 +65,36 @@ namespace ImGuiX::I18N {
 
     std::string PluralRules::category(const std::string& lang, long long n) const {
         // Try loaded rules first
+        if (const Rule* r = match(lang, n)) return r->category;
+        return plural_category_name(builtin_category(lang, n));
+    }
+
+    PluralCategory PluralRules::category_id(const std::string& lang, long long n) const {
+        if (const Rule* r = match(lang, n)) return r->id;
+        return builtin_category(lang, n);
+    }
+
+    const PluralRules::Rule* PluralRules::match(const std::string& lang, long long n) const {
         if (auto it = rules_.find(lang); it != rules_.end()) {
             for (const auto& r : it->second.rules) {
-                if (eval_rule(r.cond, n)) return r.category;
+                if (eval_rule(r.cond, n)) return &r;
             }
         }
+        return nullptr;
+    }
 
+    PluralCategory PluralRules::builtin_category(const std::string& lang, long long n) noexcept {
         // Fallbacks
         if (lang == u8"ru") {
             long long n10 = n % 10;
             long long n100 = n % 100;
-            if (n10 == 1 && n100 != 11) return u8"one";
-            if (n10 >= 2 && n10 <= 4 && !(n100 >= 12 && n100 <= 14)) return u8"few";
-            if (n10 == 0 || (n10 >= 5 && n10 <= 9) || (n100 >= 11 && n100 <= 14)) return u8"many";
-            return u8"other";
+            if (n10 == 1 && n100 != 11) return PluralCategory::One;
+            if (n10 >= 2 && n10 <= 4 && !(n100 >= 12 && n100 <= 14)) return PluralCategory::Few;
+            if (n10 == 0 || (n10 >= 5 && n10 <= 9) || (n100 >= 11 && n100 <= 14)) return PluralCategory::Many;
+            return PluralCategory::Other;
         }
         // default English-like
-        return (n == 1) ? u8"one" : u8"other";
+        return (n == 1) ? PluralCategory::One : PluralCategory::Other;
     }
 
     std::string PluralRules::read_file(const std::string& path) {
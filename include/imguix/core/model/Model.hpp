@@ -7,6 +7,27 @@
 
 namespace ImGuiX {
 
+    /// \brief Thread on which the application runs Model::process().
+    enum class ModelAffinity {
+        UiThread,    ///< Loop thread, before worker models (default).
+        AnyWorker,   ///< Any scheduler worker; idle workers steal it.
+        PinnedWorker ///< Always the same worker, see ModelExecution::worker.
+    };
+
+    /// \brief Per-model execution options used by ModelScheduler.
+    struct ModelExecution {
+        ModelAffinity affinity{ModelAffinity::UiThread}; ///< Where process() runs.
+        std::size_t worker{0}; ///< Worker index for PinnedWorker (taken modulo worker count).
+        /// \brief Let process() span frames instead of being joined every frame.
+        /// \details Worker affinities only. The frame does not wait for the call,
+        ///          and the model is skipped in frames in which its previous call is
+        ///          still running. Its event handlers may then run concurrently with
+        ///          process() and must synchronize shared state themselves. A
+        ///          PinnedWorker busy with a detached call delays joined models
+        ///          pinned to the same worker.
+        bool detached{false};
+    };
+
     /// \brief Base class for non-visual logic models.
     ///
     /// Provides access to application-level services and a safe event interface.
@@ -30,8 +51,24 @@ namespace ImGuiX {
         virtual void onInit() {}
 
         /// \brief Called every frame by the application.
+        /// \note On a worker thread the notifier queues events via notifyAsync,
+        ///       so subscribers still run on the UI thread.
         virtual void process(ImGuiX::Pubsub::SyncNotifier&) = 0;
 
+        /// \brief Select where process() runs when the model scheduler has workers.
+        /// \param execution Affinity options; applied from the next frame.
+        /// \note Unless ModelExecution::detached is set, event handlers of the model
+        ///       never run concurrently with its process(), and the frame waits
+        ///       for the slowest worker model.
+        void setExecution(const ModelExecution& execution) {
+            m_execution = execution;
+        }
+
+        /// \brief Returns execution options of the model.
+        const ModelExecution& execution() const {
+            return m_execution;
+        }
+
         /// \brief Requests the application to close gracefully.
         virtual void close() {
             m_app.close();
@@ -60,6 +97,9 @@ namespace ImGuiX {
 
     protected:
         ApplicationContext& m_app; ///< Reference to the owning application.
+
+    private:
+        ModelExecution m_execution{}; ///< Scheduler affinity.
     };
 
 } // namespace ImGuiX
@@ -0,0 +1,132 @@
+#pragma once
+#ifndef _IMGUIX_CORE_MODEL_MODEL_SCHEDULER_HPP_INCLUDED
+#define _IMGUIX_CORE_MODEL_MODEL_SCHEDULER_HPP_INCLUDED
+
+/// \file ModelScheduler.hpp
+/// \brief Runs Model::process() on the UI thread or on a work-stealing thread pool.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ImGuiX {
+
+    /// \brief Execution-time statistics of a single model.
+    struct ModelStats {
+        static constexpr std::size_t kUiThread = std::numeric_limits<std::size_t>::max(); ///< Value of `worker` for the UI thread.
+
+        const Model* model{nullptr};          ///< Model the stats belong to.
+        std::chrono::nanoseconds last{0};     ///< Duration of the latest process() call.
+        std::chrono::nanoseconds average{0};  ///< Exponential moving average of process() duration.
+        std::chrono::nanoseconds peak{0};     ///< Longest process() call so far.
+        std::uint64_t runs{0};                ///< Number of process() calls.
+        std::size_t worker{kUiThread};        ///< Thread that ran the latest call.
+    };
+
+    /// \class ModelScheduler
+    /// \brief Per-frame executor of application models.
+    /// \details Each frame the UI-thread models run first on the calling thread with
+    ///          a synchronous notifier. Worker models are then spread over per-worker
+    ///          deques: pinned models go to a private queue of their worker, the rest
+    ///          are distributed round-robin and may be stolen by idle workers and by
+    ///          the calling thread. run() returns once every joined model has
+    ///          finished, so the following EventBus::process() never overlaps their
+    ///          process(); the slowest of them still sets the frame time.
+    ///          Detached models (ModelExecution::detached) are only queued: run()
+    ///          does not wait for them, the calling thread never runs them, and a
+    ///          model whose previous call is still running is skipped.
+    ///          Worker models receive a deferred SyncNotifier that queues events via
+    ///          notifyAsync. Without workers every model runs on the calling thread.
+    class ModelScheduler {
+    public:
+        ModelScheduler() = default;
+
+        /// \brief Stops worker threads.
+        ~ModelScheduler();
+
+        ModelScheduler(const ModelScheduler&) = delete;
+        ModelScheduler& operator=(const ModelScheduler&) = delete;
+
+        /// \brief Set the number of worker threads.
+        /// \param count Worker count; 0 runs every model on the calling thread.
+        /// \note Must not be called concurrently with run().
+        void setWorkerCount(std::size_t count);
+
+        /// \brief Returns the number of worker threads.
+        std::size_t workerCount() const noexcept { return m_workers.size(); }
+
+        /// \brief Run process() of every model once.
+        /// \param models Models in creation order; must outlive the scheduler's
+        ///        workers when detached models are used.
+        /// \param bus Event bus passed to the notifiers.
+        /// \throws Rethrows the first exception thrown by a worker model (for a
+        ///         detached model, at the next run()).
+        void run(const std::vector<std::unique_ptr<Model>>& models, Pubsub::EventBus& bus);
+
+        /// \brief Returns a copy of the per-model statistics in creation order.
+        std::vector<ModelStats> stats() const;
+
+    private:
+        struct Task {
+            std::size_t index;   ///< Position in the model list (stats slot).
+            Model* model;
+            Pubsub::EventBus* bus;
+            std::atomic<bool>* in_flight; ///< Set for detached tasks; not counted in m_pending.
+        };
+
+        struct Worker {
+            std::mutex mutex;
+            std::deque<Task> tasks;    ///< Stealable joined models.
+            std::deque<Task> detached; ///< Stealable detached models; workers only.
+            std::deque<Task> pinned;   ///< Models bound to this worker.
+            std::thread thread;
+        };
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::deque<std::atomic<bool>> m_in_flight; ///< Per model: detached call queued or running.
+
+        std::mutex m_wake_mutex;
+        std::condition_variable m_wake_cv;
+        std::uint64_t m_epoch{0};          ///< Incremented when a frame is published.
+        bool m_stop{false};
+
+        std::atomic<std::size_t> m_pending{0}; ///< Worker models not finished yet.
+        std::mutex m_done_mutex;
+        std::condition_variable m_done_cv;
+        std::exception_ptr m_error;            ///< First worker failure of the frame.
+        std::size_t m_next_worker{0};          ///< Round-robin cursor.
+
+        mutable std::mutex m_stats_mutex;
+        std::vector<ModelStats> m_stats;
+
+        void stopWorkers();
+        void workerLoop(std::size_t index);
+
+        /// \brief Pop own work, then steal from other workers.
+        /// \param self Worker index or ModelStats::kUiThread for the calling thread.
+        /// \param out Task to run.
+        /// \return False if no work is left.
+        /// \note Detached tasks are taken only after all joined work, and never by
+        ///       the calling thread.
+        bool takeTask(std::size_t self, Task& out);
+
+        void runModel(const Task& task, std::size_t worker);
+        void rethrowError();
+        void record(std::size_t index, std::size_t worker, std::chrono::nanoseconds elapsed);
+    };
+
+} // namespace ImGuiX
+
+#ifdef IMGUIX_HEADER_ONLY
+#   include "ModelScheduler.ipp"
+#endif
+
+#endif // _IMGUIX_CORE_MODEL_MODEL_SCHEDULER_HPP_INCLUDED
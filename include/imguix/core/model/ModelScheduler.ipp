@@ -0,0 +1,204 @@
+#include <imguix/config/build.hpp>
+
+namespace ImGuiX {
+
+    IMGUIX_IMPL_INLINE ModelScheduler::~ModelScheduler() {
+        stopWorkers();
+    }
+
+    IMGUIX_IMPL_INLINE void ModelScheduler::setWorkerCount(std::size_t count) {
+        if (count == m_workers.size()) return;
+        stopWorkers();
+        m_stop = false;
+        m_next_worker = 0;
+        m_workers.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            m_workers.emplace_back(std::make_unique<Worker>());
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            m_workers[i]->thread = std::thread([this, i] { workerLoop(i); });
+        }
+    }
+
+    IMGUIX_IMPL_INLINE void ModelScheduler::stopWorkers() {
+        {
+            std::lock_guard<std::mutex> lk(m_wake_mutex);
+            m_stop = true;
+        }
+        m_wake_cv.notify_all();
+        for (auto& worker : m_workers) {
+            if (worker->thread.joinable()) worker->thread.join();
+        }
+        m_workers.clear();
+        // Detached tasks still queued were dropped with their workers.
+        for (auto& flag : m_in_flight) flag.store(false, std::memory_order_relaxed);
+    }
+
+    IMGUIX_IMPL_INLINE void ModelScheduler::run(
+            const std::vector<std::unique_ptr<Model>>& models,
+            Pubsub::EventBus& bus) {
+        {
+            std::lock_guard<std::mutex> lk(m_stats_mutex);
+            if (m_stats.size() != models.size()) m_stats.resize(models.size());
+            for (std::size_t i = 0; i < models.size(); ++i) m_stats[i].model = models[i].get();
+        }
+        while (m_in_flight.size() < models.size()) m_in_flight.emplace_back(false);
+
+        const bool has_workers = !m_workers.empty();
+        Pubsub::SyncNotifier notifier{bus};
+        for (std::size_t i = 0; i < models.size(); ++i) {
+            if (has_workers && models[i]->execution().affinity != ModelAffinity::UiThread) continue;
+            const auto start = std::chrono::steady_clock::now();
+            models[i]->process(notifier);
+            record(i, ModelStats::kUiThread, std::chrono::steady_clock::now() - start);
+        }
+        if (!has_workers) return;
+
+        std::size_t queued = 0;
+        std::size_t joined = 0;
+        for (std::size_t i = 0; i < models.size(); ++i) {
+            const ModelExecution& exec = models[i]->execution();
+            if (exec.affinity == ModelAffinity::UiThread) continue;
+            const Task task{i, models[i].get(), &bus, exec.detached ? &m_in_flight[i] : nullptr};
+            if (task.in_flight && task.in_flight->exchange(true, std::memory_order_acq_rel)) {
+                continue; // previous call still running
+            }
+            if (exec.affinity == ModelAffinity::PinnedWorker) {
+                Worker& w = *m_workers[exec.worker % m_workers.size()];
+                std::lock_guard<std::mutex> lk(w.mutex);
+                w.pinned.push_back(task);
+            } else {
+                Worker& w = *m_workers[m_next_worker];
+                m_next_worker = (m_next_worker + 1) % m_workers.size();
+                std::lock_guard<std::mutex> lk(w.mutex);
+                (task.in_flight ? w.detached : w.tasks).push_back(task);
+            }
+            ++queued;
+            if (!task.in_flight) ++joined;
+        }
+        if (queued == 0) {
+            rethrowError();
+            return;
+        }
+
+        m_pending.store(joined, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lk(m_wake_mutex);
+            ++m_epoch;
+        }
+        m_wake_cv.notify_all();
+
+        // Help with stealable work instead of idling until the join.
+        Task task{};
+        while (takeTask(ModelStats::kUiThread, task)) runModel(task, ModelStats::kUiThread);
+
+        {
+            std::unique_lock<std::mutex> lk(m_done_mutex);
+            m_done_cv.wait(lk, [this] { return m_pending.load(std::memory_order_acquire) == 0; });
+        }
+        rethrowError();
+    }
+
+    IMGUIX_IMPL_INLINE void ModelScheduler::rethrowError() {
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lk(m_done_mutex);
+            std::swap(error, m_error);
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+    IMGUIX_IMPL_INLINE std::vector<ModelStats> ModelScheduler::stats() const {
+        std::lock_guard<std::mutex> lk(m_stats_mutex);
+        return m_stats;
+    }
+
+    IMGUIX_IMPL_INLINE void ModelScheduler::workerLoop(std::size_t self) {
+        std::uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lk(m_wake_mutex);
+                m_wake_cv.wait(lk, [&] { return m_stop || m_epoch != seen; });
+                if (m_stop) return;
+                seen = m_epoch;
+            }
+            Task task{};
+            while (takeTask(self, task)) runModel(task, self);
+        }
+    }
+
+    IMGUIX_IMPL_INLINE bool ModelScheduler::takeTask(std::size_t self, Task& out) {
+        const std::size_t count = m_workers.size();
+        if (self < count) {
+            Worker& own = *m_workers[self];
+            std::lock_guard<std::mutex> lk(own.mutex);
+            if (!own.pinned.empty()) {
+                out = own.pinned.front();
+                own.pinned.pop_front();
+                return true;
+            }
+            if (!own.tasks.empty()) {
+                out = own.tasks.back();
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+        // Steal the oldest task, starting after our own slot to spread contention.
+        const std::size_t start = self < count ? self + 1 : 0;
+        for (std::size_t k = 0; k < count; ++k) {
+            Worker& victim = *m_workers[(start + k) % count];
+            std::lock_guard<std::mutex> lk(victim.mutex);
+            if (victim.tasks.empty()) continue;
+            out = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+        if (self >= count) return false;
+        // Joined work is done; continue with detached models, own queue first.
+        for (std::size_t k = 0; k < count; ++k) {
+            Worker& victim = *m_workers[(self + k) % count];
+            std::lock_guard<std::mutex> lk(victim.mutex);
+            if (victim.detached.empty()) continue;
+            out = victim.detached.front();
+            victim.detached.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    IMGUIX_IMPL_INLINE void ModelScheduler::runModel(const Task& task, std::size_t worker) {
+        Pubsub::SyncNotifier notifier{*task.bus, true};
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            task.model->process(notifier);
+        } catch (...) {
+            std::lock_guard<std::mutex> lk(m_done_mutex);
+            if (!m_error) m_error = std::current_exception();
+        }
+        record(task.index, worker, std::chrono::steady_clock::now() - start);
+
+        if (task.in_flight) {
+            task.in_flight->store(false, std::memory_order_release);
+            return;
+        }
+        if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lk(m_done_mutex);
+            m_done_cv.notify_all();
+        }
+    }
+
+    IMGUIX_IMPL_INLINE void ModelScheduler::record(
+            std::size_t index,
+            std::size_t worker,
+            std::chrono::nanoseconds elapsed) {
+        std::lock_guard<std::mutex> lk(m_stats_mutex);
+        ModelStats& s = m_stats[index];
+        s.last = elapsed;
+        s.peak = std::max(s.peak, elapsed);
+        // EMA with alpha = 1/8; the first sample seeds the average.
+        s.average = s.runs == 0 ? elapsed : s.average + (elapsed - s.average) / 8;
+        s.worker = worker;
+        ++s.runs;
+    }
+
+} // namespace ImGuiX
@@ -46,6 +46,9 @@ namespace ImGuiX::Notify {
         /// \brief Remove all queued notifications.
         void clear() { m_notifications.clear(); }
 
+        /// \brief Returns true if no toast is shown.
+        bool empty() const { return m_notifications.empty(); }
+
         /// \brief Render all active notifications.
         void render();
 
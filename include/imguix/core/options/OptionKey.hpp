@@ -0,0 +1,84 @@
+#pragma once
+#ifndef _IMGUIX_CORE_OPTIONS_OPTION_KEY_HPP_INCLUDED
+#define _IMGUIX_CORE_OPTIONS_OPTION_KEY_HPP_INCLUDED
+
+/// \file OptionKey.hpp
+/// \brief Typed handle caching the decoded value of one option.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ImGuiX {
+
+    class OptionsStore;
+
+    /// \brief Change counter shared between OptionsStore and the handles of one key.
+    struct OptionKeySlot {
+        std::atomic<std::uint64_t> version{1}; ///< Bumped on every write of the key.
+    };
+
+    /// \class OptionKey
+    /// \brief Typed option handle with lock-free reads of a cached value.
+    /// \tparam T One of bool, std::int32_t, std::int64_t, float, double,
+    ///         std::string or std::vector<std::string>.
+    /// \details The handle binds to a per-key change counter once. get() compares
+    ///          that counter with the one seen at the last decode and returns the
+    ///          cached value when it has not moved; only after the key is written,
+    ///          erased or reloaded does it take the store lock and decode again.
+    /// \note The cached value lives in the handle; give each thread its own copy.
+    template <typename T>
+    class OptionKey {
+        static_assert(std::is_same<T, bool>::value ||
+                      std::is_same<T, std::int32_t>::value ||
+                      std::is_same<T, std::int64_t>::value ||
+                      std::is_same<T, float>::value ||
+                      std::is_same<T, double>::value ||
+                      std::is_same<T, std::string>::value ||
+                      std::is_same<T, std::vector<std::string>>::value,
+                      "unsupported option type");
+    public:
+        OptionKey() = default;
+
+        /// \brief Returns the option value, or the default if missing or not convertible.
+        const T& get() const;
+
+        /// \brief Shortcut for get().
+        const T& operator*() const { return get(); }
+
+        /// \brief Option key name.
+        const std::string& name() const noexcept { return m_name; }
+
+        /// \brief Value returned when the option is missing.
+        const T& defaultValue() const noexcept { return m_default; }
+
+        /// \brief Returns true if the handle is bound to a store.
+        explicit operator bool() const noexcept { return m_store != nullptr; }
+
+    private:
+        friend class OptionsStore;
+
+        OptionKey(const OptionsStore& store,
+                  std::shared_ptr<const OptionKeySlot> slot,
+                  std::string name,
+                  T def)
+            : m_store(&store),
+              m_slot(std::move(slot)),
+              m_name(std::move(name)),
+              m_default(std::move(def)) {}
+
+        const OptionsStore* m_store{nullptr};
+        std::shared_ptr<const OptionKeySlot> m_slot;
+        std::string m_name;
+        T m_default{};
+        mutable T m_value{};
+        mutable std::uint64_t m_seen{0}; ///< Slot version of m_value; 0 if never decoded.
+    };
+
+} // namespace ImGuiX
+
+#endif // _IMGUIX_CORE_OPTIONS_OPTION_KEY_HPP_INCLUDED
@@ -0,0 +1,37 @@
+#pragma once
+
+namespace ImGuiX {
+
+    template <typename T>
+    OptionKey<T> OptionsStore::key(std::string name, T def) const {
+        auto slot = keySlot(name);
+        return OptionKey<T>(*this, std::move(slot), std::move(name), std::move(def));
+    }
+
+    template <typename T>
+    const T& OptionKey<T>::get() const {
+        if (!m_store) return m_default;
+        const std::uint64_t version = m_slot->version.load(std::memory_order_acquire);
+        if (version == m_seen) return m_value;
+
+        // Read after the version so a concurrent write forces another decode.
+        if constexpr (std::is_same<T, bool>::value) {
+            m_value = m_store->getBoolOr(m_name, m_default);
+        } else if constexpr (std::is_same<T, std::int32_t>::value) {
+            m_value = m_store->getI32Or(m_name, m_default);
+        } else if constexpr (std::is_same<T, std::int64_t>::value) {
+            m_value = m_store->getI64Or(m_name, m_default);
+        } else if constexpr (std::is_same<T, float>::value) {
+            m_value = m_store->getF32Or(m_name, m_default);
+        } else if constexpr (std::is_same<T, double>::value) {
+            m_value = m_store->getF64Or(m_name, m_default);
+        } else if constexpr (std::is_same<T, std::string>::value) {
+            m_value = m_store->getStrOr(m_name, m_default);
+        } else {
+            m_value = m_store->getStrVecOr(m_name, m_default);
+        }
+        m_seen = version;
+        return m_value;
+    }
+
+} // namespace ImGuiX
@@ -12,15 +12,38 @@
 
 #include <imguix/config/options.hpp>
 
+#include "OptionKey.hpp"
 #include "OptionsStoreViewCRTP.hpp"
 #include "OptionsStoreControlCRTP.hpp"
 
 namespace ImGuiX {
 
+    /// \brief When OptionsStore forces written data to stable storage.
+    enum class OptionsFsyncPolicy {
+        Never,   ///< Leave it to the OS.
+        OnFlush, ///< fsync on saveNow() and flush() only.
+        Always   ///< fsync after every save.
+    };
+
+    /// \brief On-disk encoding of the options file.
+    enum class OptionsFileFormat {
+        Auto,        ///< By extension: .msgpack/.mpk MessagePack, .cbor CBOR, otherwise JSON.
+        Json,        ///< Pretty-printed JSON.
+        MessagePack, ///< Binary MessagePack.
+        Cbor         ///< Binary CBOR.
+    };
+
     /// \class OptionsStore
     /// \brief Durable JSON-backed key-value options storage.
     /// \thread_safety Thread-safe.
     /// \note Call update() periodically to perform debounced saves.
+    /// \note Binary formats load and save several times faster than JSON. When a
+    ///       binary file does not exist yet, the JSON file with the same stem is
+    ///       loaded instead and the next save writes the binary file.
+    /// \note Saves copy the JSON tree under the store lock and hand the copy to a
+    ///       writer thread, which serializes and writes it; setters and getters
+    ///       never wait for disk I/O. Without threads (Emscripten) the copy is
+    ///       written by the calling thread after the lock is released.
     class OptionsStore :
         private OptionsStoreViewCRTP<OptionsStore>,
         private OptionsStoreControlCRTP<OptionsStore> {
@@ -29,13 +52,16 @@ namespace ImGuiX {
         using Control = OptionsStoreControlCRTP<OptionsStore>;
 
         /// \brief Construct store.
-        /// \param path JSON file path.
+        /// \param path Options file path.
         /// \param save_delay_sec Debounce window for saving (seconds).
+        /// \param format File encoding; Auto picks it from the extension.
         explicit OptionsStore(
                 std::string path,
-                double save_delay_sec = IMGUIX_OPTIONS_SAVE_DELAY_SEC);
+                double save_delay_sec = IMGUIX_OPTIONS_SAVE_DELAY_SEC,
+                OptionsFileFormat format = OptionsFileFormat::Auto);
         
         /// \brief Construct store using default path from configuration.
+        /// \note The format follows the extension of IMGUIX_OPTIONS_FILENAME.
         explicit OptionsStore();
 
         /// \brief Destroy store.
@@ -45,11 +71,52 @@ namespace ImGuiX {
         void load() noexcept;
 
         /// \brief Force immediate save (best-effort, atomic write).
+        /// \note Returns after the file has been written.
         void saveNow() noexcept;
 
-        /// \brief Tick method. Saves if there were changes and debounce elapsed.
+        /// \brief Tick method. Queues a save if there were changes and debounce elapsed.
         void update() noexcept;
 
+        /// \brief Write pending changes and wait until every queued save is on disk.
+        /// \note Skips the write when nothing changed since the last save.
+        void flush() noexcept;
+
+        /// \brief Get the encoding used for the options file.
+        /// \return Resolved format, never Auto.
+        OptionsFileFormat fileFormat() const noexcept;
+
+        /// \brief Write all options as pretty-printed JSON.
+        /// \param path Destination file.
+        /// \return True on success.
+        bool exportJson(const std::string& path) const noexcept;
+
+        /// \brief Replace all options with the contents of a JSON file.
+        /// \param path Source file.
+        /// \return True on success; the store is unchanged on failure.
+        /// \note Schedules a save in the store's own format.
+        bool importJson(const std::string& path) noexcept;
+
+        /// \brief Set when written files are fsynced.
+        /// \param policy Fsync policy.
+        void setFsyncPolicy(OptionsFsyncPolicy policy) noexcept;
+
+        /// \brief Get the fsync policy.
+        /// \return Current policy.
+        OptionsFsyncPolicy fsyncPolicy() const noexcept;
+
+        /// \brief Append changed keys to `<file>.journal` instead of rewriting the file.
+        /// \param enabled Journal mode; defaults to IMGUIX_OPTIONS_JOURNAL.
+        /// \details Each save appends one JSON line per changed key. The journal is
+        ///          folded into a full snapshot once it exceeds
+        ///          IMGUIX_OPTIONS_JOURNAL_MAX_BYTES, after load() replayed it, and
+        ///          on saveNow(). load() replays the journal even when the mode is off,
+        ///          ignores a torn last record and skips records older than the
+        ///          snapshot (sequence in `__meta.journal_seq`).
+        void setJournalEnabled(bool enabled) noexcept;
+
+        /// \brief Returns true if saves append to the journal.
+        bool journalEnabled() const noexcept;
+
         // --- meta ---
         /// \brief Set store version.
         /// \param ver New version.
@@ -190,6 +257,18 @@ namespace ImGuiX {
                 const std::string& key,
                 std::vector<std::string> def) const noexcept;
 
+        /// \brief Bind a typed handle with cached, lock-free reads to an option.
+        /// \tparam T Option value type.
+        /// \param name Option key.
+        /// \param def Value returned while the option is missing or not convertible.
+        /// \return Handle that decodes the value again only after the key changes.
+        /// \code{.cpp}
+        /// auto scale = store.key<float>("ui.scale", 1.0f);
+        /// float s = scale.get(); // no lock unless "ui.scale" was written
+        /// \endcode
+        template <typename T>
+        OptionKey<T> key(std::string name, T def = T{}) const;
+
         /// \brief Get read-only view.
         /// \return View interface.
         View& view() noexcept { return static_cast<View&>(*this); }
@@ -206,6 +285,9 @@ namespace ImGuiX {
         struct Impl;
         std::unique_ptr<Impl> m_impl;
 
+        /// \brief Returns the change counter of a key, creating it on first use.
+        std::shared_ptr<const OptionKeySlot> keySlot(const std::string& key) const;
+
         OptionsStore(const OptionsStore&) = delete;
         OptionsStore& operator=(const OptionsStore&) = delete;
 
@@ -215,6 +297,8 @@ namespace ImGuiX {
 
 } // namespace ImGuiX
 
+#include "OptionKey.tpp"
+
 #ifdef IMGUIX_HEADER_ONLY
 #   include "OptionsStore.ipp"
 #endif
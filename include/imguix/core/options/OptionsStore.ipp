@@ -1,12 +1,26 @@
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <optional>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #ifdef __EMSCRIPTEN__
 #   include <emscripten.h>
+#elif defined(_WIN32)
+#   include <fcntl.h>
+#   include <io.h>
+#else
+#   include <fcntl.h>
+#   include <unistd.h>
 #endif
 
 #include <imguix/config/options.hpp>
@@ -23,18 +37,81 @@ namespace ImGuiX {
     struct OptionsStore::Impl {
         fs::path m_path;
         fs::path m_tmp_path;
+        fs::path m_journal_path;
         double m_save_delay{IMGUIX_OPTIONS_SAVE_DELAY_SEC};
 
+        OptionsFileFormat m_format{OptionsFileFormat::Json};
+
         mutable std::mutex m_mutex;
         json m_root = json::object();
         bool m_dirty{false};
         Clock::time_point m_last_touch{Clock::now()};
+        OptionsFsyncPolicy m_fsync{static_cast<OptionsFsyncPolicy>(IMGUIX_OPTIONS_FSYNC)};
+
+        // Journal mode: changed keys since the last write, in first-touch order.
+        bool m_journal{IMGUIX_OPTIONS_JOURNAL != 0};
+        std::vector<std::string> m_journal_keys;
+        std::unordered_set<std::string> m_journal_key_set;
+        std::size_t m_journal_bytes{0};      ///< Bytes queued to the journal since the last snapshot.
+        bool m_need_snapshot{false};         ///< Next write must be a full snapshot.
+        std::uint64_t m_journal_seq{0};      ///< Sequence of the latest snapshot, stamped on records.
+        std::atomic<bool> m_snapshot_failed{false}; ///< Set by the writer when a snapshot fails.
+
+        // Writer state; lock order is m_mutex before m_io_mutex.
+        std::mutex m_io_mutex;
+        std::condition_variable m_io_cv;
+        std::optional<json> m_pending;  ///< Latest snapshot not yet taken by the writer.
+        std::string m_pending_journal;  ///< Journal records to append after m_pending.
+        bool m_pending_sync{false};     ///< fsync the pending write.
+        std::uint64_t m_requested{0};   ///< Sequence number of the latest snapshot.
+        std::uint64_t m_completed{0};   ///< Sequence number of the latest finished write.
+        bool m_stop{false};
+#ifndef __EMSCRIPTEN__
+        std::thread m_writer;
+#endif
+
+        ~Impl() {
+#ifndef __EMSCRIPTEN__
+            {
+                std::lock_guard<std::mutex> lk(m_io_mutex);
+                m_stop = true;
+            }
+            m_io_cv.notify_all();
+            if (m_writer.joinable()) m_writer.join();
+#endif
+        }
+
+        std::unordered_map<std::string, std::shared_ptr<OptionKeySlot>> m_key_slots; ///< Change counters of bound keys.
 
         void touchLocked() {
             m_dirty = true;
             m_last_touch = Clock::now();
         }
 
+        /// \brief Mark the store dirty, invalidate OptionKey caches of \p key and
+        ///        remember the key for the journal.
+        void touchLocked(const std::string& key) {
+            touchLocked();
+            auto it = m_key_slots.find(key);
+            if (it != m_key_slots.end()) {
+                it->second->version.fetch_add(1, std::memory_order_release);
+            }
+            if (m_journal && m_journal_key_set.insert(key).second) {
+                m_journal_keys.push_back(key);
+            }
+        }
+
+        void clearJournalKeysLocked() {
+            m_journal_keys.clear();
+            m_journal_key_set.clear();
+        }
+
+        void invalidateKeysLocked() {
+            for (auto& entry : m_key_slots) {
+                entry.second->version.fetch_add(1, std::memory_order_release);
+            }
+        }
+
         static json& ensureMeta(json& root) {
             if (!root.is_object()) root = json::object();
             auto it = root.find(u8"__meta");
@@ -51,11 +128,262 @@ namespace ImGuiX {
             return &(*it);
         }
 
+        /// \brief Read the snapshot sequence stored in `__meta.journal_seq`.
+        /// \return 0 for files written before sequences were stored.
+        static std::uint64_t journalSeq(const json& root) {
+            const json* m = meta(root);
+            if (!m) return 0;
+            auto it = m->find(u8"journal_seq");
+            if (it == m->end() || !it->is_number_unsigned()) return 0;
+            return it->get<std::uint64_t>();
+        }
+
         static bool isApproxInteger(double d) {
             return std::llround(d) == static_cast<long long>(d);
         }
 
-        void saveLockedNoexcept() {
+        /// \brief Copy the tree for the writer; replaces a snapshot not taken yet.
+        /// \param sync Request fsync for this save.
+        /// \return Sequence number to wait for.
+        std::uint64_t enqueueSnapshotLocked(bool sync) {
+            m_dirty = false;
+            clearJournalKeysLocked();
+            m_journal_bytes = 0;
+            m_need_snapshot = false;
+            m_snapshot_failed.store(false, std::memory_order_relaxed);
+            json snapshot = m_root;
+            // Records of older snapshots are skipped on replay, so a journal left
+            // behind by a crash between the rename and its removal is harmless.
+            ensureMeta(snapshot)[u8"journal_seq"] = ++m_journal_seq;
+            std::lock_guard<std::mutex> io(m_io_mutex);
+            m_pending = std::move(snapshot);
+            // Queued records are part of the snapshot.
+            m_pending_journal.clear();
+            return requestWriteLocked(sync);
+        }
+
+        /// \brief Queue journal records for the keys changed since the last write.
+        /// \return Sequence number to wait for.
+        std::uint64_t enqueueJournalLocked(bool sync) {
+            // Nothing tracked (flush after an unsynced write); a snapshot also compacts.
+            if (m_journal_keys.empty()) return enqueueSnapshotLocked(sync);
+            m_dirty = false;
+            std::string records;
+            for (const auto& key : m_journal_keys) {
+                json rec = json::object();
+                rec[u8"s"] = m_journal_seq;
+                rec[u8"k"] = key;
+                auto it = m_root.find(key);
+                if (it != m_root.end()) rec[u8"v"] = *it; // no "v" means erased
+                records += rec.dump();
+                records += '\n';
+            }
+            clearJournalKeysLocked();
+            m_journal_bytes += records.size();
+            std::lock_guard<std::mutex> io(m_io_mutex);
+            m_pending_journal += records;
+            return requestWriteLocked(sync);
+        }
+
+        /// \brief Queue pending changes as journal records or a full snapshot.
+        std::uint64_t enqueueChangesLocked(bool sync) {
+            const bool snapshot = !m_journal
+                    || m_need_snapshot
+                    || m_snapshot_failed.load(std::memory_order_relaxed)
+                    || m_journal_bytes >= IMGUIX_OPTIONS_JOURNAL_MAX_BYTES;
+            return snapshot ? enqueueSnapshotLocked(sync) : enqueueJournalLocked(sync);
+        }
+
+        /// \brief Bump the request sequence and wake the writer.
+        /// \note Requires m_io_mutex.
+        std::uint64_t requestWriteLocked(bool sync) {
+            m_pending_sync = m_pending_sync || sync || m_fsync == OptionsFsyncPolicy::Always;
+            const std::uint64_t seq = ++m_requested;
+#ifndef __EMSCRIPTEN__
+            if (!m_writer.joinable()) {
+                m_writer = std::thread([this] { writerLoop(); });
+            }
+            m_io_cv.notify_all();
+#endif
+            return seq;
+        }
+
+        bool hasPendingWriteLocked() const {
+            return m_pending.has_value() || !m_pending_journal.empty();
+        }
+
+        /// \brief Take the pending snapshot and journal records and write them.
+        /// \return False if nothing was pending.
+        bool writePendingNoexcept(std::unique_lock<std::mutex>& io) {
+            if (!hasPendingWriteLocked()) return false;
+            std::optional<json> snapshot = std::move(m_pending);
+            m_pending.reset();
+            std::string records;
+            records.swap(m_pending_journal);
+            const bool sync = m_pending_sync;
+            m_pending_sync = false;
+            const std::uint64_t seq = m_requested;
+            io.unlock();
+            if (snapshot) {
+                if (writeFileNoexcept(*snapshot, sync)) {
+                    // The snapshot covers every journaled change.
+                    std::error_code ec;
+                    fs::remove(m_journal_path, ec);
+                } else {
+                    m_snapshot_failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            if (!records.empty()) appendJournalNoexcept(records, sync);
+            io.lock();
+            m_completed = seq;
+            m_io_cv.notify_all();
+            return true;
+        }
+
+        void appendJournalNoexcept(const std::string& records, bool sync) {
+            try {
+                if (!m_journal_path.parent_path().empty()) {
+                    std::error_code ec;
+                    fs::create_directories(m_journal_path.parent_path(), ec);
+                }
+                {
+                    std::ofstream jf(m_journal_path, std::ios::binary | std::ios::app);
+                    if (!jf.good()) throw std::runtime_error(u8"journal open failed");
+                    jf.write(records.data(), static_cast<std::streamsize>(records.size()));
+                    jf.flush();
+                    if (!jf.good()) throw std::runtime_error(u8"journal write failed");
+                }
+                if (sync) syncPathNoexcept(m_journal_path);
+            } catch (...) {
+                m_snapshot_failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        /// \brief Apply journal records on top of the loaded snapshot.
+        /// \return True if the journal existed and was not empty.
+        /// \note Stops at the first incomplete or invalid record (torn write). Skips
+        ///       records stamped with a sequence older than the snapshot.
+        static bool replayJournal(const fs::path& path, json& root) {
+            std::ifstream jf(path, std::ios::binary);
+            if (!jf.good()) return false;
+            const std::uint64_t snapshot_seq = journalSeq(root);
+            bool any = false;
+            std::string line;
+            while (std::getline(jf, line)) {
+                any = true;
+                if (jf.eof()) break; // last line without '\n' was cut short
+                try {
+                    json rec = json::parse(line);
+                    auto k = rec.find(u8"k");
+                    if (!rec.is_object() || k == rec.end() || !k->is_string()) break;
+                    auto seq = rec.find(u8"s");
+                    if (seq != rec.end() && seq->is_number_unsigned()
+                            && seq->get<std::uint64_t>() < snapshot_seq) {
+                        continue;
+                    }
+                    auto v = rec.find(u8"v");
+                    if (v != rec.end()) {
+                        root[k->get<std::string>()] = std::move(*v);
+                    } else {
+                        root.erase(k->get<std::string>());
+                    }
+                } catch (...) {
+                    break;
+                }
+            }
+            return any;
+        }
+
+#ifndef __EMSCRIPTEN__
+        void writerLoop() {
+            std::unique_lock<std::mutex> io(m_io_mutex);
+            for (;;) {
+                m_io_cv.wait(io, [this] { return m_stop || hasPendingWriteLocked(); });
+                if (!writePendingNoexcept(io) && m_stop) return;
+            }
+        }
+#endif
+
+        /// \brief Block until the write with sequence \p seq has finished.
+        void waitWritten(std::uint64_t seq) {
+            std::unique_lock<std::mutex> io(m_io_mutex);
+#ifdef __EMSCRIPTEN__
+            while (m_completed < seq && writePendingNoexcept(io)) {}
+#else
+            m_io_cv.wait(io, [&] { return m_completed >= seq; });
+#endif
+        }
+
+        static void syncPathNoexcept(const fs::path& path) {
+#if defined(__EMSCRIPTEN__)
+            (void)path;
+#elif defined(_WIN32)
+            int fd = _wopen(path.c_str(), _O_RDWR | _O_BINARY);
+            if (fd < 0) return;
+            _commit(fd);
+            _close(fd);
+#else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) return;
+            ::fsync(fd);
+            ::close(fd);
+#endif
+        }
+
+        static OptionsFileFormat resolveFormat(const fs::path& path, OptionsFileFormat format) {
+            if (format != OptionsFileFormat::Auto) return format;
+            const auto ext = path.extension().u8string();
+            if (ext == u8".msgpack" || ext == u8".mpk") return OptionsFileFormat::MessagePack;
+            if (ext == u8".cbor") return OptionsFileFormat::Cbor;
+            return OptionsFileFormat::Json;
+        }
+
+        void setPath(fs::path path, OptionsFileFormat format) {
+            m_path = std::move(path);
+            m_tmp_path = m_path;
+            m_tmp_path += u8".tmp";
+            m_journal_path = m_path;
+            m_journal_path += u8".journal";
+            m_format = resolveFormat(m_path, format);
+        }
+
+        /// \brief Read and decode a file.
+        /// \return Root object, or nullopt if the file is missing or invalid.
+        static std::optional<json> readFile(const fs::path& path, OptionsFileFormat format) {
+            std::ifstream f(path, std::ios::binary | std::ios::ate);
+            if (!f.good()) return std::nullopt;
+            try {
+                const std::streamoff size = f.tellg();
+                if (size <= 0) return std::nullopt;
+                std::vector<std::uint8_t> bytes(static_cast<std::size_t>(size));
+                f.seekg(0);
+                if (!f.read(reinterpret_cast<char*>(bytes.data()), size)) return std::nullopt;
+                json j;
+                switch (format) {
+                case OptionsFileFormat::MessagePack: j = json::from_msgpack(bytes); break;
+                case OptionsFileFormat::Cbor:        j = json::from_cbor(bytes); break;
+                default:                             j = json::parse(bytes.begin(), bytes.end()); break;
+                }
+                if (!j.is_object()) return std::nullopt;
+                return j;
+            } catch (...) {
+                return std::nullopt;
+            }
+        }
+
+        static void encode(const json& root, OptionsFileFormat format, std::ofstream& out) {
+            if (format == OptionsFileFormat::MessagePack || format == OptionsFileFormat::Cbor) {
+                std::vector<std::uint8_t> bytes = format == OptionsFileFormat::Cbor
+                        ? json::to_cbor(root)
+                        : json::to_msgpack(root);
+                out.write(reinterpret_cast<const char*>(bytes.data()),
+                          static_cast<std::streamsize>(bytes.size()));
+            } else {
+                out << root.dump(4);
+            }
+        }
+
+        bool writeFileNoexcept(const json& root, bool sync) {
             try {
                 if (!m_path.parent_path().empty()) {
                     std::error_code ec;
@@ -66,9 +394,11 @@ namespace ImGuiX {
                             m_tmp_path,
                             std::ios::binary | std::ios::trunc);
                     if (!tf.good()) throw std::runtime_error(u8"tmp open failed");
-                    tf << m_root.dump(4);
+                    encode(root, m_format, tf);
                     tf.flush();
+                    if (!tf.good()) throw std::runtime_error(u8"tmp write failed");
                 }
+                if (sync) syncPathNoexcept(m_tmp_path);
 #ifdef _WIN32
                 if (!MoveFileExW(
                         m_tmp_path.c_str(),
@@ -80,13 +410,17 @@ namespace ImGuiX {
                 if (std::rename(m_tmp_path.c_str(), m_path.c_str()) != 0) {
                     throw std::runtime_error(u8"tmp rename failed");
                 }
+                // Persist the rename itself.
+                if (sync && !m_path.parent_path().empty()) syncPathNoexcept(m_path.parent_path());
 #   if defined(__EMSCRIPTEN__) && defined(IMGUIX_EMSCRIPTEN_IDBFS)
                 EM_ASM({ FS.syncfs(false, function(err){}); });
 #   endif
 #endif
+                return true;
             } catch (...) {
                 std::error_code ec;
                 fs::remove(m_tmp_path, ec);
+                return false;
             }
         }
 
@@ -175,16 +509,17 @@ namespace ImGuiX {
         }
     };
 
-    IMGUIX_IMPL_INLINE OptionsStore::OptionsStore(std::string path, double save_delay_sec)
+    IMGUIX_IMPL_INLINE OptionsStore::OptionsStore(
+            std::string path,
+            double save_delay_sec,
+            OptionsFileFormat format)
         : m_impl(std::make_unique<Impl>()) {
 #ifdef __EMSCRIPTEN__
         if (!ImGuiX::Utils::isAbsolutePath(path)) {
             path = ImGuiX::Utils::joinPaths("/imguix_fs", path);
         }
 #endif
-        m_impl->m_path = fs::u8path(path).lexically_normal();
-        m_impl->m_tmp_path = m_impl->m_path;
-        m_impl->m_tmp_path += u8".tmp";
+        m_impl->setPath(fs::u8path(path).lexically_normal(), format);
         m_impl->m_save_delay = save_delay_sec;
         load();
     }
@@ -196,45 +531,160 @@ namespace ImGuiX {
         const auto base_abs = ImGuiX::Utils::joinPaths(
                 "/imguix_fs",
                 IMGUIX_CONFIG_DIR);
-        m_impl->m_path = fs::u8path(ImGuiX::Utils::joinPaths(base_abs, IMGUIX_OPTIONS_FILENAME)).lexically_normal();
+        m_impl->setPath(
+                fs::u8path(ImGuiX::Utils::joinPaths(base_abs, IMGUIX_OPTIONS_FILENAME)).lexically_normal(),
+                OptionsFileFormat::Auto);
 #else
         const fs::path base_dir = ImGuiX::Utils::resolveExecPathFs(fs::u8path(IMGUIX_CONFIG_DIR));
-        m_impl->m_path = (base_dir / fs::u8path(IMGUIX_OPTIONS_FILENAME)).lexically_normal();
+        m_impl->setPath(
+                (base_dir / fs::u8path(IMGUIX_OPTIONS_FILENAME)).lexically_normal(),
+                OptionsFileFormat::Auto);
 #endif
-        m_impl->m_tmp_path = m_impl->m_path;
-        m_impl->m_tmp_path += u8".tmp";
         load();
     }
 
     IMGUIX_IMPL_INLINE OptionsStore::~OptionsStore() = default;
 
     IMGUIX_IMPL_INLINE void OptionsStore::load() noexcept {
+        std::optional<json> root = Impl::readFile(m_impl->m_path, m_impl->m_format);
+        bool migrated = false;
+        if (!root && m_impl->m_format != OptionsFileFormat::Json) {
+            // Migrate from the JSON file written before the binary format was chosen.
+            fs::path legacy = m_impl->m_path;
+            legacy.replace_extension(u8".json");
+            std::error_code ec;
+            if (legacy != m_impl->m_path && !fs::exists(m_impl->m_path, ec)) {
+                root = Impl::readFile(legacy, OptionsFileFormat::Json);
+                migrated = root.has_value();
+            }
+        }
+        json replayed = root ? std::move(*root) : json::object();
+        const std::uint64_t seq = Impl::journalSeq(replayed);
+        const bool journaled = Impl::replayJournal(m_impl->m_journal_path, replayed);
+        if (!root && !journaled) return;
+
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
-        std::ifstream f(m_impl->m_path, std::ios::binary);
-        if (!f.good()) return;
+        m_impl->m_root = std::move(replayed);
+        m_impl->m_journal_seq = std::max(m_impl->m_journal_seq, seq);
+        m_impl->invalidateKeysLocked();
+        // Fold replayed records into the next snapshot so the journal starts empty.
+        if (journaled) m_impl->m_need_snapshot = true;
+        if (migrated) {
+            m_impl->m_need_snapshot = true;
+            m_impl->touchLocked();
+        }
+    }
+
+    IMGUIX_IMPL_INLINE OptionsFileFormat OptionsStore::fileFormat() const noexcept {
+        return m_impl->m_format;
+    }
+
+    IMGUIX_IMPL_INLINE bool OptionsStore::exportJson(const std::string& path) const noexcept {
+        json snapshot;
+        {
+            std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+            snapshot = m_impl->m_root;
+        }
         try {
-            json j2;
-            f >> j2;
-            if (!j2.is_object()) return;
-            m_impl->m_root = std::move(j2);
-        } catch (...) {}
+            std::ofstream f(fs::u8path(path), std::ios::binary | std::ios::trunc);
+            if (!f.good()) return false;
+            f << snapshot.dump(4);
+            f.flush();
+            return f.good();
+        } catch (...) {
+            return false;
+        }
     }
 
-    IMGUIX_IMPL_INLINE void OptionsStore::saveNow() noexcept {
+    IMGUIX_IMPL_INLINE bool OptionsStore::importJson(const std::string& path) noexcept {
+        std::optional<json> root = Impl::readFile(fs::u8path(path), OptionsFileFormat::Json);
+        if (!root) return false;
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
-        m_impl->m_dirty = false;
-        m_impl->saveLockedNoexcept();
+        m_impl->m_root = std::move(*root);
+        m_impl->invalidateKeysLocked();
+        m_impl->m_need_snapshot = true;
+        m_impl->touchLocked();
+        return true;
+    }
+
+    IMGUIX_IMPL_INLINE void OptionsStore::saveNow() noexcept {
+        std::uint64_t seq = 0;
+        {
+            std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+            seq = m_impl->enqueueSnapshotLocked(m_impl->m_fsync != OptionsFsyncPolicy::Never);
+        }
+        m_impl->waitWritten(seq);
     }
 
     IMGUIX_IMPL_INLINE void OptionsStore::update() noexcept {
-        std::lock_guard<std::mutex> lk(m_impl->m_mutex);
-        if (!m_impl->m_dirty) return;
-        double elapsed = std::chrono::duration<double>(
-                Clock::now() - m_impl->m_last_touch).count();
-        if (elapsed >= m_impl->m_save_delay) {
-            m_impl->m_dirty = false;
-            m_impl->saveLockedNoexcept();
+        std::uint64_t seq = 0;
+        {
+            std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+            const bool failed = m_impl->m_snapshot_failed.load(std::memory_order_relaxed);
+            if (!m_impl->m_dirty && !failed) return;
+            const Clock::time_point now = Clock::now();
+            double elapsed = std::chrono::duration<double>(now - m_impl->m_last_touch).count();
+            if (elapsed < m_impl->m_save_delay) return;
+            // Retry a failed write at most once per save delay.
+            if (failed) m_impl->m_last_touch = now;
+            seq = m_impl->enqueueChangesLocked(false);
         }
+#ifdef __EMSCRIPTEN__
+        m_impl->waitWritten(seq);
+#else
+        (void)seq;
+#endif
+    }
+
+    IMGUIX_IMPL_INLINE void OptionsStore::flush() noexcept {
+        std::uint64_t seq = 0;
+        {
+            std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+            // Changes of a failed write are no longer marked dirty.
+            bool unsaved = m_impl->m_dirty
+                    || m_impl->m_snapshot_failed.load(std::memory_order_relaxed);
+            if (!unsaved) {
+                std::lock_guard<std::mutex> io(m_impl->m_io_mutex);
+                unsaved = m_impl->m_completed < m_impl->m_requested;
+            }
+            // An in-flight write may lack fsync; queue the current tree with it.
+            if (unsaved) {
+                seq = m_impl->enqueueChangesLocked(m_impl->m_fsync != OptionsFsyncPolicy::Never);
+            }
+        }
+        m_impl->waitWritten(seq);
+    }
+
+    IMGUIX_IMPL_INLINE void OptionsStore::setFsyncPolicy(OptionsFsyncPolicy policy) noexcept {
+        std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+        m_impl->m_fsync = policy;
+    }
+
+    IMGUIX_IMPL_INLINE OptionsFsyncPolicy OptionsStore::fsyncPolicy() const noexcept {
+        std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+        return m_impl->m_fsync;
+    }
+
+    IMGUIX_IMPL_INLINE void OptionsStore::setJournalEnabled(bool enabled) noexcept {
+        std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+        if (m_impl->m_journal == enabled) return;
+        m_impl->m_journal = enabled;
+        m_impl->clearJournalKeysLocked();
+        // Changes made before the switch are not tracked per key.
+        m_impl->m_need_snapshot = true;
+    }
+
+    IMGUIX_IMPL_INLINE bool OptionsStore::journalEnabled() const noexcept {
+        std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+        return m_impl->m_journal;
+    }
+
+    IMGUIX_IMPL_INLINE std::shared_ptr<const OptionKeySlot> OptionsStore::keySlot(
+            const std::string& key) const {
+        std::lock_guard<std::mutex> lk(m_impl->m_mutex);
+        auto& slot = m_impl->m_key_slots[key];
+        if (!slot) slot = std::make_shared<OptionKeySlot>();
+        return slot;
     }
 
     IMGUIX_IMPL_INLINE bool OptionsStore::has(const std::string& key) const noexcept {
@@ -247,7 +697,7 @@ namespace ImGuiX {
         auto it = m_impl->m_root.find(key);
         if (it == m_impl->m_root.end()) return false;
         m_impl->m_root.erase(it);
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
         return true;
     }
 
@@ -265,31 +715,31 @@ namespace ImGuiX {
     IMGUIX_IMPL_INLINE void OptionsStore::setBool(const std::string& key, bool v) noexcept {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         m_impl->m_root[key] = v;
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
     }
 
     IMGUIX_IMPL_INLINE void OptionsStore::setI32(const std::string& key, std::int32_t v) noexcept {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         m_impl->m_root[key] = static_cast<long long>(v);
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
     }
 
     IMGUIX_IMPL_INLINE void OptionsStore::setI64(const std::string& key, std::int64_t v) noexcept {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         m_impl->m_root[key] = static_cast<long long>(v);
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
     }
 
     IMGUIX_IMPL_INLINE void OptionsStore::setF32(const std::string& key, float v) noexcept {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         m_impl->m_root[key] = static_cast<double>(v);
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
     }
 
     IMGUIX_IMPL_INLINE void OptionsStore::setF64(const std::string& key, double v) noexcept {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         m_impl->m_root[key] = v;
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
     }
 
     IMGUIX_IMPL_INLINE void OptionsStore::setStr(
@@ -297,7 +747,7 @@ namespace ImGuiX {
             const std::string& v) noexcept {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         m_impl->m_root[key] = v;
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
     }
 
     IMGUIX_IMPL_INLINE void OptionsStore::setStrVec(
@@ -305,7 +755,7 @@ namespace ImGuiX {
             const std::vector<std::string>& v) noexcept {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         m_impl->m_root[key] = v;
-        m_impl->touchLocked();
+        m_impl->touchLocked(key);
     }
 
     IMGUIX_IMPL_INLINE bool OptionsStore::getBool(const std::string& key) const {
@@ -446,7 +896,7 @@ namespace ImGuiX {
         std::lock_guard<std::mutex> lk(m_impl->m_mutex);
         auto& m = Impl::ensureMeta(m_impl->m_root);
         m[u8"version"] = static_cast<long long>(ver);
-        m_impl->touchLocked();
+        m_impl->touchLocked(u8"__meta");
     }
 
     IMGUIX_IMPL_INLINE std::int32_t OptionsStore::version() const noexcept {
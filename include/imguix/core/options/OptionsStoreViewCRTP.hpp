@@ -6,11 +6,15 @@
 /// \brief Read-only facade for \c OptionsStore access.
 
 #include <string>
+#include <utility>
 #include <vector>
 #include <cstdint>
 
 namespace ImGuiX {
 
+    template <typename T>
+    class OptionKey;
+
     /// \brief Read-only facade for OptionsStore access.
     /// \tparam Impl Concrete OptionsStore implementation.
     template<class Impl>
@@ -101,6 +105,12 @@ namespace ImGuiX {
         std::int32_t version() const noexcept {
             return static_cast<const Impl*>(this)->version();
         }
+
+        /// \copydoc OptionsStore::key
+        template <typename T>
+        OptionKey<T> key(std::string name, T def = T{}) const {
+            return static_cast<const Impl*>(this)->template key<T>(std::move(name), std::move(def));
+        }
     };
 
 } // namespace ImGuiX
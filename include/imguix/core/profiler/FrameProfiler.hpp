@@ -0,0 +1,203 @@
+#pragma once
+#ifndef _IMGUIX_CORE_PROFILER_FRAME_PROFILER_HPP_INCLUDED
+#define _IMGUIX_CORE_PROFILER_FRAME_PROFILER_HPP_INCLUDED
+
+/// \file FrameProfiler.hpp
+/// \brief Per-stage frame timings of the main loop.
+/// \ingroup Core
+
+#include <imguix/config/profiler.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace ImGuiX::Profiling {
+
+    /// \brief Percentiles of one stage over the recorded history, in milliseconds.
+    struct StageStats {
+        const char* name{""};  ///< Stage name.
+        float last_ms{0.0f};   ///< Time of the latest frame.
+        float avg_ms{0.0f};    ///< Mean over the history.
+        float p50_ms{0.0f};    ///< Median.
+        float p95_ms{0.0f};    ///< 95th percentile.
+        float p99_ms{0.0f};    ///< 99th percentile.
+        float max_ms{0.0f};    ///< Slowest frame in the history.
+    };
+
+    /// \class FrameProfiler
+    /// \brief Accumulates scoped timings per stage and keeps the last frames.
+    /// \details Stage 0 is the whole frame, measured between beginFrame() and
+    ///          endFrame() minus idle time added with addIdle(). Every other stage sums all scopes recorded during the
+    ///          frame, so a stage entered several times (one per window or
+    ///          controller) reports its total. History is a fixed ring of
+    ///          kHistory frames allocated when the stage is registered; recording
+    ///          a frame does not allocate.
+    /// \note Not thread-safe; record from the thread running the main loop.
+    class FrameProfiler {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t kHistory = IMGUIX_PROFILER_HISTORY; ///< Frames kept per stage.
+        static constexpr std::size_t kFrameStage = 0;                    ///< Id of the whole-frame stage.
+
+        FrameProfiler();
+
+        /// \brief Process-wide profiler used by the IMGUIX_PROFILE_* macros.
+        static FrameProfiler& instance();
+
+        /// \brief Returns the id of a stage, registering it on first use.
+        /// \param name Stage name; must outlive the profiler (string literal or typeid name).
+        /// \return Stable stage id.
+        std::size_t stageId(const char* name);
+
+        /// \brief Returns the id of a stage named after a type, registering it on first use.
+        /// \param type Type whose readable (demangled) name labels the stage.
+        /// \return Stable stage id; cache it, the lookup hashes the type name.
+        std::size_t stageId(const std::type_info& type);
+
+        /// \brief Add time to a stage of the current frame.
+        /// \param stage Stage id from stageId().
+        /// \param elapsed Measured duration.
+        void add(std::size_t stage, clock::duration elapsed) noexcept {
+            if (stage < m_stages.size()) m_stages[stage].current += elapsed;
+        }
+
+        /// \brief Add idle time (waiting for input or a deadline) to a stage.
+        /// \details The stage reports it, the frame stage leaves it out.
+        /// \param stage Stage id from stageId().
+        /// \param elapsed Measured duration.
+        void addIdle(std::size_t stage, clock::duration elapsed) noexcept {
+            add(stage, elapsed);
+            m_idle += elapsed;
+        }
+
+        /// \brief Start measuring a frame.
+        void beginFrame() noexcept;
+
+        /// \brief Commit the current frame to the history and reset accumulators.
+        void endFrame();
+
+        /// \brief Number of registered stages, including the frame stage.
+        std::size_t stageCount() const noexcept { return m_stages.size(); }
+
+        /// \brief Returns the name of a stage.
+        const char* stageName(std::size_t stage) const noexcept {
+            return stage < m_stages.size() ? m_stages[stage].name : "";
+        }
+
+        /// \brief Number of frames committed since start or reset().
+        std::uint64_t frameCount() const noexcept { return m_frames; }
+
+        /// \brief Number of frames currently held in the history.
+        std::size_t historySize() const noexcept {
+            return m_frames < kHistory ? static_cast<std::size_t>(m_frames) : kHistory;
+        }
+
+        /// \brief Copy the history of a stage, oldest first, in milliseconds.
+        /// \param stage Stage id.
+        /// \param out Receives historySize() values; reuses its capacity.
+        void history(std::size_t stage, std::vector<float>& out) const;
+
+        /// \brief Compute statistics of a stage over the history.
+        StageStats stats(std::size_t stage) const;
+
+        /// \brief Drop the history while keeping registered stages.
+        void reset() noexcept;
+
+    private:
+        struct Stage {
+            const char* name;
+            clock::duration current{};
+            std::vector<float> history; ///< Ring of kHistory values in milliseconds.
+        };
+
+        std::vector<Stage> m_stages;
+        std::unordered_map<const char*, std::size_t> m_ids; ///< Lookup by name pointer.
+        std::unordered_map<std::type_index, std::size_t> m_type_ids; ///< Lookup by type.
+        std::deque<std::string> m_type_names; ///< Demangled names; deque keeps c_str() stable.
+        std::size_t m_head{0};             ///< Next history slot.
+        std::uint64_t m_frames{0};
+        clock::time_point m_frame_start{};
+        clock::duration m_idle{};          ///< Idle time of the current frame.
+        bool m_in_frame{false};
+        mutable std::vector<float> m_scratch; ///< Sorted copy for percentiles.
+    };
+
+    /// \class ScopedTimer
+    /// \brief Adds the lifetime of the object to a stage of the global profiler.
+    class ScopedTimer {
+    public:
+        /// \param stage Stage id from FrameProfiler::stageId().
+        /// \param idle True to leave the time out of the frame stage.
+        explicit ScopedTimer(std::size_t stage, bool idle = false) noexcept
+            : m_stage(stage), m_idle(idle), m_start(FrameProfiler::clock::now()) {}
+
+        ~ScopedTimer() {
+            const auto elapsed = FrameProfiler::clock::now() - m_start;
+            if (m_idle) FrameProfiler::instance().addIdle(m_stage, elapsed);
+            else FrameProfiler::instance().add(m_stage, elapsed);
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        std::size_t m_stage;
+        bool m_idle;
+        FrameProfiler::clock::time_point m_start;
+    };
+
+} // namespace ImGuiX::Profiling
+
+#define IMGUIX_PROFILE_CONCAT_IMPL(a, b) a##b
+#define IMGUIX_PROFILE_CONCAT(a, b) IMGUIX_PROFILE_CONCAT_IMPL(a, b)
+
+#if IMGUIX_ENABLE_PROFILER
+/// \brief Time the enclosing scope under a constant stage name.
+#   define IMGUIX_PROFILE_SCOPE(name) \
+        static const std::size_t IMGUIX_PROFILE_CONCAT(imguix_profile_id_, __LINE__) = \
+            ::ImGuiX::Profiling::FrameProfiler::instance().stageId(name); \
+        ::ImGuiX::Profiling::ScopedTimer IMGUIX_PROFILE_CONCAT(imguix_profile_timer_, __LINE__){ \
+            IMGUIX_PROFILE_CONCAT(imguix_profile_id_, __LINE__)}
+/// \brief Time the enclosing scope under a stage name computed at run time.
+#   define IMGUIX_PROFILE_SCOPE_DYNAMIC(name) \
+        ::ImGuiX::Profiling::ScopedTimer IMGUIX_PROFILE_CONCAT(imguix_profile_timer_, __LINE__){ \
+            ::ImGuiX::Profiling::FrameProfiler::instance().stageId(name)}
+/// \brief Time the enclosing scope under a stage id cached by the caller.
+#   define IMGUIX_PROFILE_SCOPE_ID(id) \
+        ::ImGuiX::Profiling::ScopedTimer IMGUIX_PROFILE_CONCAT(imguix_profile_timer_, __LINE__){id}
+/// \brief Time an idle wait; reported under \p name but left out of the frame time.
+#   define IMGUIX_PROFILE_IDLE_SCOPE(name) \
+        static const std::size_t IMGUIX_PROFILE_CONCAT(imguix_profile_id_, __LINE__) = \
+            ::ImGuiX::Profiling::FrameProfiler::instance().stageId(name); \
+        ::ImGuiX::Profiling::ScopedTimer IMGUIX_PROFILE_CONCAT(imguix_profile_timer_, __LINE__){ \
+            IMGUIX_PROFILE_CONCAT(imguix_profile_id_, __LINE__), true}
+/// \brief Stage id named after a type, for IMGUIX_PROFILE_SCOPE_ID().
+#   define IMGUIX_PROFILE_TYPE_STAGE(type) \
+        ::ImGuiX::Profiling::FrameProfiler::instance().stageId(typeid(type))
+/// \brief Mark the start of a frame.
+#   define IMGUIX_PROFILE_FRAME_BEGIN() ::ImGuiX::Profiling::FrameProfiler::instance().beginFrame()
+/// \brief Commit the current frame.
+#   define IMGUIX_PROFILE_FRAME_END() ::ImGuiX::Profiling::FrameProfiler::instance().endFrame()
+#else
+#   define IMGUIX_PROFILE_SCOPE(name) ((void)0)
+#   define IMGUIX_PROFILE_SCOPE_DYNAMIC(name) ((void)0)
+#   define IMGUIX_PROFILE_SCOPE_ID(id) ((void)0)
+#   define IMGUIX_PROFILE_IDLE_SCOPE(name) ((void)0)
+#   define IMGUIX_PROFILE_TYPE_STAGE(type) (std::size_t{0})
+#   define IMGUIX_PROFILE_FRAME_BEGIN() ((void)0)
+#   define IMGUIX_PROFILE_FRAME_END() ((void)0)
+#endif
+
+#ifdef IMGUIX_HEADER_ONLY
+#   include "FrameProfiler.ipp"
+#endif
+
+#endif // _IMGUIX_CORE_PROFILER_FRAME_PROFILER_HPP_INCLUDED
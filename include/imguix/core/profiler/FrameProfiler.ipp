@@ -0,0 +1,136 @@
+#include <imguix/config/build.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__GNUG__)
+#   include <cxxabi.h>
+#endif
+
+namespace ImGuiX::Profiling {
+
+    IMGUIX_IMPL_INLINE FrameProfiler::FrameProfiler() {
+        stageId("frame");
+    }
+
+    IMGUIX_IMPL_INLINE FrameProfiler& FrameProfiler::instance() {
+        static FrameProfiler s_profiler;
+        return s_profiler;
+    }
+
+    IMGUIX_IMPL_INLINE std::size_t FrameProfiler::stageId(const char* name) {
+        auto it = m_ids.find(name);
+        if (it != m_ids.end()) return it->second;
+
+        // The same text may live at different addresses across translation units.
+        for (std::size_t i = 0; i < m_stages.size(); ++i) {
+            if (std::strcmp(m_stages[i].name, name) == 0) {
+                m_ids.emplace(name, i);
+                return i;
+            }
+        }
+
+        Stage stage;
+        stage.name = name;
+        stage.history.assign(kHistory, 0.0f);
+        m_stages.push_back(std::move(stage));
+        const std::size_t id = m_stages.size() - 1;
+        m_ids.emplace(name, id);
+        return id;
+    }
+
+    IMGUIX_IMPL_INLINE std::size_t FrameProfiler::stageId(const std::type_info& type) {
+        auto it = m_type_ids.find(std::type_index(type));
+        if (it != m_type_ids.end()) return it->second;
+
+        std::string name = type.name();
+#       if defined(__GNUG__)
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        if (status == 0 && demangled) name = demangled;
+        std::free(demangled);
+#       else
+        // MSVC names are readable but prefixed with "class " or "struct ".
+        for (const char* prefix : {"class ", "struct "}) {
+            if (name.compare(0, std::strlen(prefix), prefix) == 0) {
+                name.erase(0, std::strlen(prefix));
+                break;
+            }
+        }
+#       endif
+        m_type_names.push_back(std::move(name));
+        const std::size_t id = stageId(m_type_names.back().c_str());
+        m_type_ids.emplace(std::type_index(type), id);
+        return id;
+    }
+
+    IMGUIX_IMPL_INLINE void FrameProfiler::beginFrame() noexcept {
+        for (auto& stage : m_stages) stage.current = clock::duration::zero();
+        m_idle = clock::duration::zero();
+        m_frame_start = clock::now();
+        m_in_frame = true;
+    }
+
+    IMGUIX_IMPL_INLINE void FrameProfiler::endFrame() {
+        if (!m_in_frame) return;
+        m_in_frame = false;
+        m_stages[kFrameStage].current = clock::now() - m_frame_start - m_idle;
+        for (auto& stage : m_stages) {
+            stage.history[m_head] =
+                std::chrono::duration<float, std::milli>(stage.current).count();
+            stage.current = clock::duration::zero();
+        }
+        m_head = (m_head + 1) % kHistory;
+        ++m_frames;
+    }
+
+    IMGUIX_IMPL_INLINE void FrameProfiler::history(std::size_t stage, std::vector<float>& out) const {
+        out.clear();
+        if (stage >= m_stages.size()) return;
+        const std::size_t count = historySize();
+        const std::size_t first = (m_head + kHistory - count) % kHistory;
+        const auto& ring = m_stages[stage].history;
+        for (std::size_t i = 0; i < count; ++i) {
+            out.push_back(ring[(first + i) % kHistory]);
+        }
+    }
+
+    IMGUIX_IMPL_INLINE StageStats FrameProfiler::stats(std::size_t stage) const {
+        StageStats s;
+        if (stage >= m_stages.size()) return s;
+        s.name = m_stages[stage].name;
+        const std::size_t count = historySize();
+        if (count == 0) return s;
+
+        history(stage, m_scratch);
+        s.last_ms = m_scratch.back();
+        float sum = 0.0f;
+        for (float v : m_scratch) sum += v;
+        s.avg_ms = sum / static_cast<float>(count);
+
+        std::sort(m_scratch.begin(), m_scratch.end());
+        // Nearest-rank percentile.
+        auto rank = [&](double p) {
+            std::size_t k = static_cast<std::size_t>(p * static_cast<double>(count) + 0.999999);
+            return m_scratch[std::min(count, std::max<std::size_t>(k, 1)) - 1];
+        };
+        s.p50_ms = rank(0.50);
+        s.p95_ms = rank(0.95);
+        s.p99_ms = rank(0.99);
+        s.max_ms = m_scratch.back();
+        return s;
+    }
+
+    IMGUIX_IMPL_INLINE void FrameProfiler::reset() noexcept {
+        for (auto& stage : m_stages) {
+            std::fill(stage.history.begin(), stage.history.end(), 0.0f);
+            stage.current = clock::duration::zero();
+        }
+        m_head = 0;
+        m_frames = 0;
+        m_idle = clock::duration::zero();
+        m_in_frame = false;
+    }
+
+} // namespace ImGuiX::Profiling
@@ -11,6 +11,8 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -21,11 +23,14 @@
 #include <type_traits>
 #include <typeindex>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
+#include "pubsub/EventPool.hpp"
 #include "pubsub/Event.hpp"
 #include "pubsub/EventListener.hpp"
 #include "pubsub/awaiters.hpp"
+#include "pubsub/EventRingBuffer.hpp"
 #include "pubsub/EventBus.hpp"
 #include "pubsub/cancellation.hpp"
 #include "pubsub/EventAwaiter.hpp"
@@ -6,8 +6,86 @@
 /// \brief Defines the base Event class used in the publish-subscribe pattern.
 /// \ingroup Core
 
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+
+#include "EventPool.hpp"
+
 namespace ImGuiX::Pubsub {
 
+    /// \brief Dense per-process identifier of an event type.
+    /// \details IDs start at zero and are assigned on first use, so they can index flat tables.
+    using EventTypeId = std::uint32_t;
+
+    /// \brief Sentinel value for "no event type".
+    constexpr EventTypeId kInvalidEventTypeId = static_cast<EventTypeId>(-1);
+
+    namespace detail {
+
+        /// \brief Map a runtime type to its dense ID, assigning a new ID on first use.
+        /// \param type Runtime type of the event.
+        /// \return Dense event type ID.
+        /// \note Slow path guarded by a mutex; eventTypeId<T>() caches the result per type.
+        ///       Defined in Event.ipp so a compiled library and the modules linking
+        ///       it share one registry.
+        EventTypeId eventTypeIdOf(const std::type_index& type);
+
+        /// \brief Per-thread cache in front of eventTypeIdOf().
+        /// \param type Runtime type of the event.
+        /// \return Dense event type ID.
+        /// \details Keyed by the address of type_info::name(), so a hit is a pointer
+        ///          compare without locks or hashing. Only the first sighting of a type
+        ///          on a thread takes the registry mutex. Entries are trivially
+        ///          destructible, so the cache stays usable during thread teardown.
+        inline EventTypeId cachedEventTypeIdOf(const std::type_index& type) {
+            struct Entry {
+                const char* name;
+                EventTypeId id;
+            };
+            constexpr std::size_t kSlots = 32;
+            thread_local Entry t_entries[kSlots] = {};
+            thread_local std::size_t t_next = 0;
+
+            const char* name = type.name();
+            for (const Entry& e : t_entries) {
+                if (e.name == name) return e.id;
+            }
+            const EventTypeId id = eventTypeIdOf(type);
+            t_entries[t_next] = Entry{name, id};
+            t_next = (t_next + 1) % kSlots;
+            return id;
+        }
+
+        /// \brief Copy-assign \p src into \p dst when both are exactly \p T.
+        /// \tparam T Concrete event type.
+        /// \return False if the types differ or \p T is not copy-assignable.
+        template <typename T, typename Base>
+        bool assignEvent(Base& dst, const T& src) {
+            if constexpr (std::is_copy_assignable<T>::value) {
+                if (!dst.template is<T>()) return false;
+                static_cast<T&>(dst) = src;
+                return true;
+            } else {
+                (void)dst;
+                (void)src;
+                return false;
+            }
+        }
+
+    } // namespace detail
+
+    /// \brief Returns the dense ID of event type \p T.
+    /// \tparam T Event type.
+    /// \return ID resolved once per type and then read from a function-local static.
+    template <typename T>
+    EventTypeId eventTypeId() noexcept {
+        static const EventTypeId s_id = detail::eventTypeIdOf(std::type_index(typeid(T)));
+        return s_id;
+    }
+
     /// \class Event
     /// \brief Base class for events in the publish-subscribe system.
     ///
@@ -23,6 +101,17 @@ namespace ImGuiX::Pubsub {
         /// \note This method allows identifying the exact type of the event at runtime.
         ///       Useful for dispatching or logging without relying on dynamic_cast.
         virtual std::type_index type() const = 0;
+
+        /// \brief Returns the dense type ID of the event used for dispatch.
+        /// \return ID equal to eventTypeId<T>() of the concrete type.
+        /// \note The default resolves type() through a per-thread cache without
+        ///       locks. Override it (see IMGUIX_EVENT_TYPE_ID) to skip the virtual
+        ///       type() call. A subclass that overrides type() must also override
+        ///       typeId() if a base class already does; EventBus asserts this in
+        ///       debug builds.
+        virtual EventTypeId typeId() const {
+            return detail::cachedEventTypeIdOf(type());
+        }
         
         /// \brief Returns the name of the event type.
         /// \return A string literal representing the name of the event.
@@ -32,13 +121,45 @@ namespace ImGuiX::Pubsub {
         /// \brief Creates a deep copy of the event.
         /// \return A unique pointer to the cloned event.
         virtual std::unique_ptr<Event> clone() const = 0;
+
+        /// \brief Copies this event into an existing event of the same concrete type.
+        /// \param target Event to overwrite.
+        /// \return False if the types differ; callers then fall back to clone().
+        /// \note Lets caches reuse storage instead of allocating a fresh clone.
+        ///       Implemented by IMGUIX_CLONEABLE_EVENT.
+        virtual bool copyTo(Event& target) const {
+            (void)target;
+            return false;
+        }
+
+#       if IMGUIX_PUBSUB_EVENT_POOL
+        /// \brief Allocates events from EventPool.
+        static void* operator new(std::size_t size) {
+            return EventPool::allocate(size);
+        }
+
+        /// \brief Returns event storage to EventPool.
+        static void operator delete(void* ptr, std::size_t size) noexcept {
+            EventPool::deallocate(ptr, size);
+        }
+
+        /// \brief Over-aligned events bypass the pool.
+        static void* operator new(std::size_t size, std::align_val_t align) {
+            return ::operator new(size, align);
+        }
+
+        /// \brief Over-aligned events bypass the pool.
+        static void operator delete(void* ptr, std::size_t size, std::align_val_t align) noexcept {
+            ::operator delete(ptr, size, align);
+        }
+#       endif
         
         /// \brief Checks whether the event is of the specified type.
         /// \tparam T The type to check against.
         /// \return true if the event is of type T; otherwise false.
         template <typename T>
         bool is() const {
-            return type() == typeid(T);
+            return typeId() == eventTypeId<T>();
         }
 
         /// \brief Attempts to cast the event to the specified type.
@@ -62,7 +183,21 @@ namespace ImGuiX::Pubsub {
         }
     };
     
-    /// \brief Helper macro for implementing clone() in derived event types.
+    namespace detail {
+
+        /// \brief Returns event.typeId(), checking it against type() in debug builds.
+        /// \details Catches a subclass that overrides type() but inherits typeId()
+        ///          from a base event and would be dispatched as that base.
+        inline EventTypeId dispatchTypeId(const Event& event) {
+            const EventTypeId id = event.typeId();
+            assert(id == eventTypeIdOf(event.type()) &&
+                   u8"Event::typeId() does not match type(); override typeId() (IMGUIX_EVENT_TYPE_ID)");
+            return id;
+        }
+
+    } // namespace detail
+
+    /// \brief Helper macro for implementing clone() and copyTo() in derived event types.
     /// \details Should be placed inside the public section of the derived class.
     /// Example usage:
     ///   struct MyEvent : public Event {
@@ -70,10 +205,29 @@ namespace ImGuiX::Pubsub {
     ///       ...
     ///   };
     #define IMGUIX_CLONEABLE_EVENT(TypeName) \
-        std::unique_ptr<Event> clone() const override { \
+        std::unique_ptr<::ImGuiX::Pubsub::Event> clone() const override { \
             return std::make_unique<TypeName>(*this); \
+        } \
+        bool copyTo(::ImGuiX::Pubsub::Event& target) const override { \
+            return ::ImGuiX::Pubsub::detail::assignEvent<TypeName>(target, *this); \
+        }
+
+    /// \brief Helper macro for implementing typeId() in derived event types.
+    /// \details Should be placed inside the public section of the derived class.
+    /// Example usage:
+    ///   struct MyEvent : public Event {
+    ///       IMGUIX_EVENT_TYPE_ID(MyEvent)
+    ///       ...
+    ///   };
+    #define IMGUIX_EVENT_TYPE_ID(TypeName) \
+        ::ImGuiX::Pubsub::EventTypeId typeId() const override { \
+            return ::ImGuiX::Pubsub::eventTypeId<TypeName>(); \
         }
 
 } // namespace ImGuiX::Pubsub
 
+#ifdef IMGUIX_HEADER_ONLY
+#   include "Event.ipp"
+#endif
+
 #endif // _IMGUIX_PUBSUB_EVENT_HPP_INCLUDED
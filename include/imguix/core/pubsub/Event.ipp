@@ -0,0 +1,19 @@
+#include <imguix/config/build.hpp>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace ImGuiX::Pubsub::detail {
+
+    IMGUIX_IMPL_INLINE EventTypeId eventTypeIdOf(const std::type_index& type) {
+        static std::mutex s_mutex;
+        static std::unordered_map<std::type_index, EventTypeId> s_ids;
+        std::lock_guard<std::mutex> lock(s_mutex);
+        auto it = s_ids.find(type);
+        if (it != s_ids.end()) return it->second;
+        const auto id = static_cast<EventTypeId>(s_ids.size());
+        s_ids.emplace(type, id);
+        return id;
+    }
+
+} // namespace ImGuiX::Pubsub::detail
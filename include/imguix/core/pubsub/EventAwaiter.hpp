@@ -20,6 +20,12 @@ namespace ImGuiX::Pubsub {
         std::function<void()> on_timeout{};            ///< Called when timeout expires.
     };
 
+    /// \brief Correlation key matched by keyed awaiters (e.g. a request id).
+    using AwaitKey = std::uint64_t;
+
+    template <typename EventType>
+    class AwaiterIndex;
+
     /// \class EventAwaiter
     /// \brief Helper listener that waits for events matching a predicate.
     /// \details Holds a shared_ptr to itself until cancelled or, if single-shot, after the first match.
@@ -54,6 +60,31 @@ namespace ImGuiX::Pubsub {
             return self;
         }
 
+        /// \brief Create an awaiter matched through a correlation-key index.
+        /// \param bus Event bus the index is subscribed on.
+        /// \param index Index routing events to awaiters by key.
+        /// \param key Correlation key to wait for.
+        /// \param predicate Additional predicate. If empty, every event with \p key matches.
+        /// \param on_match Callback invoked when a matching event is received.
+        /// \param opt Await options controlling timeout/cancellation and single-shot behavior.
+        /// \return Shared pointer keeping the awaiter alive.
+        [[nodiscard]] static std::shared_ptr<EventAwaiter> createKeyed(
+                EventBus& bus,
+                const std::shared_ptr<AwaiterIndex<EventType>>& index,
+                AwaitKey key,
+                Predicate predicate,
+                Callback on_match,
+                AwaitOptions opt = {}) {
+            auto self = std::shared_ptr<EventAwaiter>(new EventAwaiter(
+                bus, std::move(predicate), std::move(on_match), std::move(opt)
+            ));
+            self->m_index = index;
+            self->m_key = key;
+            self->m_keyed = true;
+            self->subscribeInternal();
+            return self;
+        }
+
         /// \copydoc IAwaiter::isActive
         bool isActive() const noexcept override {
             return !m_cancelled.load(std::memory_order_relaxed);
@@ -70,6 +101,8 @@ namespace ImGuiX::Pubsub {
         void onEvent(const Event* const) override {}
 
     private:
+        friend class AwaiterIndex<EventType>;
+
         EventAwaiter(EventBus& bus,
                      Predicate predicate,
                      Callback on_match,
@@ -104,6 +137,15 @@ namespace ImGuiX::Pubsub {
             if (m_on_match) m_on_match(ev);
         }
 
+        /// \copydoc IAwaiterEx::pollDeadline
+        /// \note A cancellation token can only be observed by polling, so awaiters
+        ///       holding one are polled on every process().
+        std::chrono::steady_clock::time_point pollDeadline() const noexcept override {
+            if (m_opt.token) return std::chrono::steady_clock::time_point::min();
+            if (m_has_deadline) return m_deadline;
+            return std::chrono::steady_clock::time_point::max();
+        }
+
         /// \copydoc IAwaiterEx::pollTimeout
         void pollTimeout() noexcept override {
             if (!isActive()) return;
@@ -129,19 +171,125 @@ namespace ImGuiX::Pubsub {
         std::chrono::steady_clock::time_point m_deadline{};
         std::atomic<bool> m_cancelled{false};
         std::shared_ptr<EventAwaiter> m_retain_self; ///< Keeps this object alive until cancellation.
+        std::weak_ptr<AwaiterIndex<EventType>> m_index; ///< Index used instead of a bus subscription.
+        AwaitKey m_key{0};                             ///< Correlation key inside m_index.
+        bool m_keyed{false};                           ///< True if registered in m_index.
+    };
+
+    /// \class AwaiterIndex
+    /// \brief Routes events to keyed awaiters by correlation key.
+    /// \details Subscribes to the bus once per event type. Each event's key is
+    ///          computed once and looked up in a hash index, so the cost of a
+    ///          delivery does not grow with the number of pending awaiters.
+    /// \tparam EventType Event type to route.
+    template <typename EventType>
+    class AwaiterIndex : public EventListener,
+                         public std::enable_shared_from_this<AwaiterIndex<EventType>> {
+    public:
+        /// \brief Extracts the correlation key from an event.
+        using KeyFunction = std::function<AwaitKey(const EventType&)>;
+
+        /// \brief Create an index and subscribe it on the bus.
+        /// \param bus Event bus to subscribe on.
+        /// \param key_fn Correlation key extractor.
+        /// \return Shared pointer owning the index.
+        [[nodiscard]] static std::shared_ptr<AwaiterIndex> create(EventBus& bus, KeyFunction key_fn) {
+            auto self = std::shared_ptr<AwaiterIndex>(new AwaiterIndex(bus, std::move(key_fn)));
+            std::weak_ptr<AwaiterIndex> weak_self = self;
+            bus.subscribe<EventType>(self.get(), [weak_self](const EventType& ev) {
+                if (auto index = weak_self.lock()) index->dispatch(ev);
+            });
+            return self;
+        }
+
+        /// \brief Unsubscribe from the bus.
+        ~AwaiterIndex() override { m_bus.template unsubscribe<EventType>(this); }
+
+        /// \brief Returns the number of registered awaiters.
+        std::size_t size() const {
+            std::lock_guard<std::mutex> lk(m_mutex);
+            return m_awaiters.size();
+        }
+
+        /// \copydoc EventListener::onEvent
+        void onEvent(const Event* const) override {}
+
+    private:
+        friend class EventAwaiter<EventType>;
+        using Awaiter = EventAwaiter<EventType>;
+
+        AwaiterIndex(EventBus& bus, KeyFunction key_fn)
+            : m_bus(bus), m_key_fn(std::move(key_fn)) {}
+
+        /// \brief Index entry; \c raw identifies the awaiter even after \c weak expired.
+        struct Entry {
+            const Awaiter* raw;
+            std::weak_ptr<Awaiter> weak;
+        };
+
+        void add(AwaitKey key, const Awaiter* raw, std::weak_ptr<Awaiter> aw) {
+            std::lock_guard<std::mutex> lk(m_mutex);
+            m_awaiters.emplace(key, Entry{raw, std::move(aw)});
+        }
+
+        void remove(AwaitKey key, const Awaiter* aw) noexcept {
+            std::lock_guard<std::mutex> lk(m_mutex);
+            auto range = m_awaiters.equal_range(key);
+            for (auto it = range.first; it != range.second;) {
+                // Expired entries belong to awaiters being destroyed right now;
+                // they are dropped here too, their own remove() finds nothing.
+                if (it->second.raw == aw || it->second.weak.expired()) {
+                    it = m_awaiters.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        void dispatch(const EventType& ev) {
+            const AwaitKey key = m_key_fn(ev);
+            std::shared_ptr<Awaiter> first;
+            std::vector<std::shared_ptr<Awaiter>> rest;
+            {
+                std::lock_guard<std::mutex> lk(m_mutex);
+                auto range = m_awaiters.equal_range(key);
+                for (auto it = range.first; it != range.second; ++it) {
+                    auto sp = it->second.weak.lock();
+                    if (!sp) continue;
+                    if (!first) first = std::move(sp);
+                    else rest.emplace_back(std::move(sp));
+                }
+            }
+            // Handlers run unlocked: single-shot awaiters remove themselves on match.
+            if (first) first->handleEvent(ev);
+            for (auto& aw : rest) aw->handleEvent(ev);
+        }
+
+        EventBus& m_bus;
+        KeyFunction m_key_fn;
+        mutable std::mutex m_mutex;
+        std::unordered_multimap<AwaitKey, Entry> m_awaiters; ///< Pending awaiters by key.
     };
 
     template <typename EventType>
     inline void EventAwaiter<EventType>::cancel() noexcept {
         bool expected = false;
         if (!m_cancelled.compare_exchange_strong(expected, true)) return;
-        m_bus.template unsubscribe<EventType>(this);
+        if (m_keyed) {
+            if (auto index = m_index.lock()) index->remove(m_key, this);
+        } else {
+            m_bus.template unsubscribe<EventType>(this);
+        }
         m_retain_self.reset();
     }
 
     template <typename EventType>
     inline void EventAwaiter<EventType>::subscribeInternal() {
         if (m_opt.single_shot) m_retain_self = this->shared_from_this(); // keep until first hit
+        if (m_keyed) {
+            if (auto index = m_index.lock()) index->add(m_key, this, this->weak_from_this());
+            return;
+        }
         auto weak_self = this->weak_from_this();
         m_bus.subscribe<EventType>(this, [weak_self](const EventType& ev){
             if (auto self = weak_self.lock()) self->handleEvent(ev);
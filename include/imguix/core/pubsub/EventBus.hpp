@@ -6,10 +6,44 @@
 /// \brief Contains the EventBus class for event-based communication between modules.
 /// \ingroup Core
 
+#include <condition_variable>
+#include <thread>
+
+#include "EventRingBuffer.hpp"
+
 namespace ImGuiX::Pubsub {
 
+    /// \brief Behavior of notifyAsync() when the bounded async queue is full.
+    enum class AsyncOverflowPolicy {
+        Block,        ///< Wait until process() frees a slot.
+        DropOldest,   ///< Discard the oldest queued event.
+        DropNewest,   ///< Discard the event being posted.
+        CoalesceByKey ///< Keep only the latest overflowing event per key.
+    };
+
+    /// \brief Configuration of the EventBus async queue.
+    struct AsyncQueueOptions {
+        std::size_t capacity{0};                                ///< Zero keeps the unbounded mutex-guarded queue.
+        AsyncOverflowPolicy overflow{AsyncOverflowPolicy::Block}; ///< Policy applied when the ring is full.
+        std::size_t batch_size{64};                             ///< Events drained per batch in process().
+        std::function<std::uint64_t(const Event&)> coalesce_key{}; ///< Key for CoalesceByKey within an event type; empty keys by type only.
+    };
+
+    /// \brief Counters of the bounded async queue.
+    struct AsyncQueueStats {
+        std::size_t capacity{0};   ///< Ring capacity; zero when unbounded.
+        std::size_t size{0};       ///< Approximate number of queued events.
+        std::size_t high_water{0}; ///< Largest observed queue size.
+        std::uint64_t dropped{0};  ///< Events discarded by the overflow policy.
+        std::uint64_t coalesced{0}; ///< Overflowing events replaced by a newer one with the same key.
+        std::uint64_t conflated{0}; ///< Latest-wins events replaced before process() delivered them.
+    };
+
     /// \class EventBus
     /// \brief Manages subscriptions and notifications for event-based communication.
+    /// \details Subscriptions are edited under a mutex and published as an immutable
+    ///          dispatch snapshot. notify() only loads the current snapshot, so the
+    ///          dispatch path takes no locks and performs no heap allocations.
     class EventBus {
     public:
         using callback_t = std::function<void(const Event* const)>;
@@ -55,6 +89,8 @@ namespace ImGuiX::Pubsub {
 
         /// \brief Notifies all subscribers of an event by raw pointer.
         /// \param event Raw pointer to the event to notify subscribers of.
+        /// \note Subscribers are taken from the snapshot current at call time;
+        ///       (un)subscribing from inside a callback affects only later notifications.
         void notify(const Event* const event) const;
 
         /// \brief Notifies subscribers of an event by reference.
@@ -63,28 +99,234 @@ namespace ImGuiX::Pubsub {
 
         /// \brief Queues an event for asynchronous processing.
         /// \param event Unique pointer to the event.
+        /// \note With a bounded queue the configured AsyncOverflowPolicy applies.
+        ///       Block never waits on the thread running process(); such events
+        ///       spill into the unbounded queue instead of deadlocking.
         void notifyAsync(std::unique_ptr<Event> event);
 
+        /// \brief Constructs an event in pooled storage and queues it.
+        /// \tparam EventType Type of the event to construct.
+        /// \param args Constructor arguments.
+        template <typename EventType, typename... Args>
+        void emplaceAsync(Args&&... args);
+
         /// \brief Processes queued events.
+        /// \details Events already queued on entry are dispatched; the bounded
+        ///          ring is drained in batches of AsyncQueueOptions::batch_size.
+        /// \return Number of events dispatched.
         /// \thread_safety Not thread-safe; call from main thread.
-        void process();
+        std::size_t process();
+
+        /// \brief Switch the async queue to a bounded lock-free ring buffer.
+        /// \param options Capacity, overflow policy and batch size. Zero capacity
+        ///        restores the unbounded queue.
+        /// \thread_safety Call before producer threads start posting events.
+        void configureAsyncQueue(AsyncQueueOptions options);
+
+        /// \brief Returns async queue counters.
+        /// \return Snapshot of capacity, size, high-water mark and drop counters.
+        AsyncQueueStats asyncQueueStats() const;
+
+        /// \brief Deliver only the most recent queued instance of EventType per process() call.
+        /// \tparam EventType Event type to conflate.
+        /// \details Applies to notifyAsync(); notify() still dispatches every event.
+        ///          Conflated events are dispatched after the regular queue, in order
+        ///          of the first arrival of each key since the previous process().
+        template <typename EventType>
+        void setLatestWins();
+
+        /// \brief Deliver only the most recent queued instance of EventType per key.
+        /// \tparam EventType Event type to conflate.
+        /// \param key Extracts the user key (e.g. symbol id) that separates streams.
+        template <typename EventType>
+        void setLatestWins(std::function<std::uint64_t(const EventType&)> key);
+
+        /// \brief Restore regular queuing for EventType.
+        /// \tparam EventType Event type.
+        /// \note Events already held in latest-wins slots are still delivered.
+        template <typename EventType>
+        void clearLatestWins();
 
         /// \brief Registers an awaiter for timeout/cancellation polling.
         /// \param aw Awaiter to register.
+        /// \details Awaiters are scheduled by IAwaiterEx::pollDeadline(): those with a
+        ///          deadline sit in a min-heap and are touched only once it expires,
+        ///          those returning time_point::max() are never polled.
         void registerAwaiter(const std::shared_ptr<IAwaiterEx>& aw);
 
     private:
-        std::unordered_map<std::type_index, callback_list_t> m_event_callbacks; ///< Event type -> callbacks
-        std::unordered_map<std::type_index, listener_list_t> m_event_listeners; ///< Event type -> listeners
+        /// \brief Immutable subscriber lists of a single event type.
+        struct DispatchBucket {
+            callback_list_t callbacks;
+            listener_list_t listeners;
+        };
+
+        /// \brief Latest-wins rule of an event type.
+        struct ConflationRule {
+            std::function<std::uint64_t(const Event&)> key; ///< Empty: one slot per event type.
+        };
+
+        /// \brief Immutable snapshot of all subscriptions read by notify().
+        struct DispatchTable {
+            std::vector<std::shared_ptr<const DispatchBucket>> buckets;    ///< Indexed by EventTypeId; null if unused
+            std::vector<std::shared_ptr<const ConflationRule>> conflation; ///< Indexed by EventTypeId; null if not conflated
+        };
+
+        /// \brief RAII registration of a thread reading the dispatch snapshot.
+        /// \details Readers announce themselves before loading the snapshot; writers
+        ///          only free retired snapshots after observing a zero reader count.
+        class DispatchReadGuard {
+        public:
+            explicit DispatchReadGuard(std::atomic<std::size_t>& readers) noexcept : m_readers(readers) {
+                m_readers.fetch_add(1, std::memory_order_seq_cst);
+            }
+            ~DispatchReadGuard() { m_readers.fetch_sub(1, std::memory_order_seq_cst); }
+            DispatchReadGuard(const DispatchReadGuard&) = delete;
+            DispatchReadGuard& operator=(const DispatchReadGuard&) = delete;
+        private:
+            std::atomic<std::size_t>& m_readers;
+        };
+
+        /// \brief Key of a latest-wins slot: event type plus user key.
+        struct LatestKey {
+            EventTypeId type;
+            std::uint64_t key;
+            bool operator==(const LatestKey& other) const noexcept {
+                return type == other.type && key == other.key;
+            }
+        };
+
+        struct LatestKeyHash {
+            std::size_t operator()(const LatestKey& k) const noexcept {
+                return std::hash<std::uint64_t>{}((k.key * 0x9E3779B97F4A7C15ULL) ^ k.type);
+            }
+        };
+
+        /// \brief Latest event per key, kept in order of first arrival.
+        struct LatestSlots {
+            std::mutex mutex;
+            std::unordered_map<LatestKey, std::size_t, LatestKeyHash> index; ///< Key -> position in events
+            std::vector<std::unique_ptr<Event>> events;
+        };
+
+        std::unordered_map<EventTypeId, callback_list_t> m_event_callbacks; ///< Event type -> callbacks
+        std::unordered_map<EventTypeId, listener_list_t> m_event_listeners; ///< Event type -> listeners
 
         mutable std::mutex m_queue_mutex; ///< Mutex for thread-safe queue operations
         mutable std::mutex m_subscriptions_mutex;
-        std::queue<std::unique_ptr<Event>> m_event_queue; ///< Queue for asynchronous event processing
+        std::vector<std::unique_ptr<Event>> m_event_queue;   ///< Queue for asynchronous event processing
+        std::vector<std::unique_ptr<Event>> m_process_queue; ///< Events being dispatched by process() (consumer only)
+
+        std::atomic<const DispatchTable*> m_dispatch{nullptr};    ///< Snapshot used by notify()
+        mutable std::atomic<std::size_t> m_dispatch_readers{0};   ///< Threads currently reading a snapshot
+        std::unique_ptr<const DispatchTable> m_dispatch_owner;    ///< Owns the published snapshot
+        std::vector<std::unique_ptr<const DispatchTable>> m_dispatch_retired; ///< Replaced snapshots awaiting reclamation
+        std::atomic<bool> m_has_retired{false};                   ///< True while m_dispatch_retired is not empty
+
+        AsyncQueueOptions m_async_options;              ///< Bounded queue configuration
+        std::unique_ptr<EventRingBuffer> m_ring;        ///< Bounded async queue; null when unbounded
+        std::vector<std::unique_ptr<Event>> m_batch;    ///< Events of the batch being dispatched (consumer only)
+        LatestSlots m_overflow;                         ///< Latest overflowing event per key (CoalesceByKey)
+        LatestSlots m_latest;                           ///< Pending events of latest-wins types
+        std::atomic<std::size_t> m_high_water{0};       ///< Largest observed ring size
+        std::atomic<std::uint64_t> m_dropped{0};        ///< Events dropped by the overflow policy
+        std::atomic<std::uint64_t> m_coalesced{0};      ///< Overflowing events replaced by a newer one
+        std::atomic<std::uint64_t> m_conflated{0};      ///< Latest-wins events replaced by a newer one
+        std::mutex m_block_mutex;                       ///< Used by producers waiting under AsyncOverflowPolicy::Block
+        std::condition_variable m_block_cv;             ///< Signalled when process() frees ring slots
+        std::atomic<int> m_blocked_producers{0};        ///< Producers waiting for free slots
+        std::atomic<std::thread::id> m_consumer_thread{}; ///< Thread that last ran process()
 
-        std::vector<std::weak_ptr<IAwaiterEx>> m_awaiters; ///< Awaiters to poll
+        /// \brief Awaiter scheduled for a single poll at its deadline.
+        struct TimedAwaiter {
+            std::chrono::steady_clock::time_point deadline;
+            std::weak_ptr<IAwaiterEx> awaiter;
+        };
+
+        /// \brief Orders the timer heap so the earliest deadline is on top.
+        struct TimedAwaiterLater {
+            bool operator()(const TimedAwaiter& a, const TimedAwaiter& b) const noexcept {
+                return a.deadline > b.deadline;
+            }
+        };
+
+        std::vector<std::weak_ptr<IAwaiterEx>> m_awaiters; ///< Awaiters polled on every process()
+        std::vector<TimedAwaiter> m_timed_awaiters;        ///< Min-heap of awaiters keyed by deadline
+        std::size_t m_timed_compact_at{64};                ///< Heap size that triggers pruning of finished awaiters
+        std::vector<std::shared_ptr<IAwaiterEx>> m_awaiters_live; ///< Scratch list reused by pollAwaitersInternal()
         mutable std::mutex m_awaiters_mutex;
 
         void pollAwaitersInternal();
+
+        /// \brief Drop finished awaiters from the timer heap.
+        /// \note Caller must hold m_awaiters_mutex.
+        void compactTimedAwaitersLocked();
+
+        /// \brief Push into the bounded ring applying the overflow policy.
+        /// \param event Event to enqueue.
+        void pushBounded(std::unique_ptr<Event> event);
+
+        /// \brief Push into the unbounded mutex-guarded queue.
+        /// \param event Event to enqueue.
+        void pushUnbounded(std::unique_ptr<Event> event);
+
+        /// \brief Store an overflowing event, replacing an older one with the same key.
+        /// \param event Event to keep.
+        void coalesceOverflow(std::unique_ptr<Event> event);
+
+        /// \brief Divert an event of a latest-wins type into its slot.
+        /// \param event Event to post; moved from only when diverted.
+        /// \return True if the event type is conflated.
+        bool tryConflate(std::unique_ptr<Event>& event);
+
+        /// \brief Store \p event under \p key, replacing an older one.
+        /// \param slots Slot storage.
+        /// \param key Slot key.
+        /// \param event Event to keep.
+        /// \return True if an older event was replaced.
+        static bool putLatest(LatestSlots& slots, const LatestKey& key, std::unique_ptr<Event> event);
+
+        /// \brief Dispatch and clear all events stored in \p slots.
+        /// \param slots Slot storage.
+        /// \return Number of events dispatched.
+        std::size_t drainLatest(LatestSlots& slots);
+
+        /// \brief Dispatch events queued in the bounded ring.
+        /// \return Number of events dispatched.
+        std::size_t drainBounded();
+
+        /// \brief Publish a snapshot with the latest-wins rule of \p type replaced.
+        /// \param type Event type.
+        /// \param rule New rule or nullptr to disable conflation.
+        /// \note Caller must hold m_subscriptions_mutex.
+        void publishConflationLocked(EventTypeId type, std::shared_ptr<const ConflationRule> rule);
+
+        /// \brief Raise the high-water mark to the current ring size.
+        void updateHighWater() noexcept;
+
+        /// \brief Publish a snapshot with the bucket of \p type rebuilt from the subscription maps.
+        /// \param type Event type whose subscriptions changed.
+        /// \note Caller must hold m_subscriptions_mutex.
+        void publishDispatchLocked(EventTypeId type);
+
+        /// \brief Publish a snapshot rebuilt from all subscription maps.
+        /// \note Caller must hold m_subscriptions_mutex.
+        void publishDispatchAllLocked();
+
+        /// \brief Swap in a new snapshot and retire the previous one.
+        /// \param table New snapshot.
+        /// \note Caller must hold m_subscriptions_mutex.
+        void swapDispatchLocked(std::unique_ptr<const DispatchTable> table);
+
+        /// \brief Free retired snapshots when no notify() call can still observe them.
+        /// \note Caller must hold m_subscriptions_mutex.
+        void reclaimDispatchLocked();
+
+        /// \brief Build an immutable bucket for \p type or nullptr if it has no subscribers.
+        /// \param type Event type to collect.
+        /// \return Shared bucket or nullptr.
+        /// \note Caller must hold m_subscriptions_mutex.
+        std::shared_ptr<const DispatchBucket> makeBucketLocked(EventTypeId type) const;
     };
 
 } // namespace ImGuiX::Pubsub
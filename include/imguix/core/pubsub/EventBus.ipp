@@ -4,13 +4,16 @@ namespace ImGuiX::Pubsub {
 
     IMGUIX_IMPL_INLINE void EventBus::unsubscribeAll(EventListener* owner) {
         std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
+        bool changed = false;
 
         for (auto it = m_event_callbacks.begin(); it != m_event_callbacks.end(); ) {
             auto& callback_list = it->second;
-            callback_list.erase(std::remove_if(callback_list.begin(), callback_list.end(),
+            auto new_end = std::remove_if(callback_list.begin(), callback_list.end(),
                 [owner](const CallbackRecord& rec) {
                     return rec.owner == owner;
-                }), callback_list.end());
+                });
+            changed |= new_end != callback_list.end();
+            callback_list.erase(new_end, callback_list.end());
             if (callback_list.empty()) {
                 it = m_event_callbacks.erase(it);
             } else {
@@ -20,38 +23,37 @@ namespace ImGuiX::Pubsub {
 
         for (auto it = m_event_listeners.begin(); it != m_event_listeners.end(); ) {
             auto& listener_list = it->second;
-            listener_list.erase(std::remove(listener_list.begin(), listener_list.end(), owner), listener_list.end());
+            auto new_end = std::remove(listener_list.begin(), listener_list.end(), owner);
+            changed |= new_end != listener_list.end();
+            listener_list.erase(new_end, listener_list.end());
             if (listener_list.empty()) {
                 it = m_event_listeners.erase(it);
             } else {
                 ++it;
             }
         }
+
+        if (changed) {
+            publishDispatchAllLocked();
+        }
     }
 
     IMGUIX_IMPL_INLINE void EventBus::notify(const Event* const event) const {
-        auto type = event->type();
-        
-        callback_list_t callbacks_copy;
-        listener_list_t listeners_copy;
-        
-        std::unique_lock<std::mutex> lock(m_subscriptions_mutex);
-        auto it = m_event_callbacks.find(type);
-        if (it != m_event_callbacks.end()) {
-            callbacks_copy = it->second;
-        }
+        DispatchReadGuard guard(m_dispatch_readers);
+        const DispatchTable* table = m_dispatch.load(std::memory_order_seq_cst);
+        if (!table) return;
 
-        auto it_listeners = m_event_listeners.find(type);
-        if (it_listeners != m_event_listeners.end()) {
-            listeners_copy = it_listeners->second;
-        }
-        lock.unlock();
+        const EventTypeId type = detail::dispatchTypeId(*event);
+        if (type >= table->buckets.size()) return;
+        const DispatchBucket* bucket_ptr = table->buckets[type].get();
+        if (!bucket_ptr) return;
+        const DispatchBucket& bucket = *bucket_ptr;
 
-        for (const auto& rec : callbacks_copy) {
+        for (const auto& rec : bucket.callbacks) {
             rec.callback(event);
         }
 
-        for (auto* listener : listeners_copy) {
+        for (auto* listener : bucket.listeners) {
             listener->onEvent(event);
         }
     }
@@ -61,51 +63,359 @@ namespace ImGuiX::Pubsub {
     }
 
     IMGUIX_IMPL_INLINE void EventBus::notifyAsync(std::unique_ptr<Event> event) {
+        if (!event) return;
+        if (tryConflate(event)) return;
+        if (m_ring) {
+            pushBounded(std::move(event));
+            return;
+        }
+        pushUnbounded(std::move(event));
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::pushUnbounded(std::unique_ptr<Event> event) {
         std::lock_guard<std::mutex> lock(m_queue_mutex);
-        m_event_queue.push(std::move(event));
+        m_event_queue.push_back(std::move(event));
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::pushBounded(std::unique_ptr<Event> event) {
+        for (;;) {
+            if (m_ring->tryPush(event)) {
+                updateHighWater();
+                return;
+            }
+
+            switch (m_async_options.overflow) {
+            case AsyncOverflowPolicy::DropNewest:
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            case AsyncOverflowPolicy::DropOldest:
+                if (m_ring->tryPop()) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                break;
+            case AsyncOverflowPolicy::CoalesceByKey:
+                coalesceOverflow(std::move(event));
+                return;
+            case AsyncOverflowPolicy::Block:
+            default:
+                if (m_consumer_thread.load(std::memory_order_relaxed) == std::this_thread::get_id()) {
+                    pushUnbounded(std::move(event));
+                    return;
+                }
+                {
+                    m_blocked_producers.fetch_add(1, std::memory_order_seq_cst);
+                    std::unique_lock<std::mutex> lock(m_block_mutex);
+                    // Timed wait: a slot may be freed between the failed push and the wait.
+                    m_block_cv.wait_for(lock, std::chrono::milliseconds(1));
+                    m_blocked_producers.fetch_sub(1, std::memory_order_seq_cst);
+                }
+                break;
+            }
+        }
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::coalesceOverflow(std::unique_ptr<Event> event) {
+        const LatestKey key{
+            detail::dispatchTypeId(*event),
+            m_async_options.coalesce_key ?
+                m_async_options.coalesce_key(*event) :
+                0
+        };
+        if (putLatest(m_overflow, key, std::move(event))) {
+            m_coalesced.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    IMGUIX_IMPL_INLINE bool EventBus::tryConflate(std::unique_ptr<Event>& event) {
+        DispatchReadGuard guard(m_dispatch_readers);
+        const DispatchTable* table = m_dispatch.load(std::memory_order_seq_cst);
+        if (!table) return false;
+
+        const EventTypeId type = detail::dispatchTypeId(*event);
+        if (type >= table->conflation.size()) return false;
+        const ConflationRule* rule = table->conflation[type].get();
+        if (!rule) return false;
+
+        const LatestKey key{type, rule->key ? rule->key(*event) : 0};
+        if (putLatest(m_latest, key, std::move(event))) {
+            m_conflated.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    IMGUIX_IMPL_INLINE bool EventBus::putLatest(
+            LatestSlots& slots,
+            const LatestKey& key,
+            std::unique_ptr<Event> event) {
+        std::unique_ptr<Event> replaced;
+        std::lock_guard<std::mutex> lock(slots.mutex);
+        auto it = slots.index.find(key);
+        if (it != slots.index.end()) {
+            // Destroy the stale event after releasing the lock.
+            replaced = std::move(slots.events[it->second]);
+            slots.events[it->second] = std::move(event);
+            return true;
+        }
+        slots.index.emplace(key, slots.events.size());
+        slots.events.push_back(std::move(event));
+        return false;
+    }
+
+    IMGUIX_IMPL_INLINE std::size_t EventBus::drainLatest(LatestSlots& slots) {
+        std::vector<std::unique_ptr<Event>> pending;
+        {
+            std::lock_guard<std::mutex> lock(slots.mutex);
+            if (slots.events.empty()) return 0;
+            pending.swap(slots.events);
+            slots.index.clear();
+        }
+        for (auto& event : pending) {
+            notify(event.get());
+        }
+        const std::size_t count = pending.size();
+        pending.clear();
+
+        // Hand the storage back so steady-state streams do not reallocate.
+        std::lock_guard<std::mutex> lock(slots.mutex);
+        if (slots.events.empty()) slots.events.swap(pending);
+        return count;
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::updateHighWater() noexcept {
+        const std::size_t size = m_ring->sizeApprox();
+        std::size_t prev = m_high_water.load(std::memory_order_relaxed);
+        while (size > prev &&
+               !m_high_water.compare_exchange_weak(prev, size, std::memory_order_relaxed)) {}
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::configureAsyncQueue(AsyncQueueOptions options) {
+        if (options.batch_size == 0) options.batch_size = 1;
+
+        // Events still sitting in the old ring keep their order in the unbounded queue.
+        if (m_ring) {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            while (auto event = m_ring->tryPop()) {
+                m_event_queue.push_back(std::move(event));
+            }
+        }
+
+        m_async_options = std::move(options);
+        if (m_async_options.capacity == 0) {
+            m_ring.reset();
+            m_batch.clear();
+            m_batch.shrink_to_fit();
+            return;
+        }
+        m_ring = std::make_unique<EventRingBuffer>(m_async_options.capacity);
+        m_batch.clear();
+        m_batch.reserve(m_async_options.batch_size);
+        m_high_water.store(0, std::memory_order_relaxed);
+    }
+
+    IMGUIX_IMPL_INLINE AsyncQueueStats EventBus::asyncQueueStats() const {
+        AsyncQueueStats stats;
+        if (m_ring) {
+            stats.capacity = m_ring->capacity();
+            stats.size = m_ring->sizeApprox();
+        }
+        stats.high_water = m_high_water.load(std::memory_order_relaxed);
+        stats.dropped = m_dropped.load(std::memory_order_relaxed);
+        stats.coalesced = m_coalesced.load(std::memory_order_relaxed);
+        stats.conflated = m_conflated.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    IMGUIX_IMPL_INLINE std::size_t EventBus::drainBounded() {
+        // Only events present on entry: handlers posting new events cannot starve the frame.
+        std::size_t budget = m_ring->sizeApprox();
+        std::size_t count = 0;
+        while (budget > 0) {
+            const std::size_t limit = std::min(budget, m_async_options.batch_size);
+            while (m_batch.size() < limit) {
+                auto event = m_ring->tryPop();
+                if (!event) break;
+                m_batch.push_back(std::move(event));
+            }
+            if (m_batch.empty()) break;
+            budget -= m_batch.size();
+            count += m_batch.size();
+
+            if (m_blocked_producers.load(std::memory_order_seq_cst) > 0) {
+                m_block_cv.notify_all();
+            }
+
+            for (auto& event : m_batch) {
+                notify(event.get());
+            }
+            m_batch.clear();
+        }
+
+        return count + drainLatest(m_overflow);
     }
 
     IMGUIX_IMPL_INLINE void EventBus::registerAwaiter(const std::shared_ptr<IAwaiterEx>& aw) {
+        if (!aw) return;
+        const auto deadline = aw->pollDeadline();
+        if (deadline == std::chrono::steady_clock::time_point::max()) return;
+
         std::lock_guard<std::mutex> lk(m_awaiters_mutex);
-        m_awaiters.emplace_back(aw);
+        if (deadline == std::chrono::steady_clock::time_point::min()) {
+            m_awaiters.emplace_back(aw);
+            return;
+        }
+        m_timed_awaiters.push_back(TimedAwaiter{deadline, aw});
+        std::push_heap(m_timed_awaiters.begin(), m_timed_awaiters.end(), TimedAwaiterLater{});
+        if (m_timed_awaiters.size() >= m_timed_compact_at) {
+            compactTimedAwaitersLocked();
+        }
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::compactTimedAwaitersLocked() {
+        auto& v = m_timed_awaiters;
+        v.erase(std::remove_if(v.begin(), v.end(), [](const TimedAwaiter& t) {
+            auto sp = t.awaiter.lock();
+            return !sp || !sp->isActive();
+        }), v.end());
+        std::make_heap(v.begin(), v.end(), TimedAwaiterLater{});
+        // Amortized O(1) per registration: the next pass runs after the heap doubles.
+        m_timed_compact_at = std::max<std::size_t>(64, v.size() * 2);
     }
 
     IMGUIX_IMPL_INLINE void EventBus::pollAwaitersInternal() {
-        std::vector<std::shared_ptr<IAwaiterEx>> live;
+        auto& live = m_awaiters_live;
         {
             std::lock_guard<std::mutex> lk(m_awaiters_mutex);
             auto& v = m_awaiters;
-            v.erase(std::remove_if(v.begin(), v.end(), [](const std::weak_ptr<IAwaiterEx>& w){
-                auto sp = w.lock();
-                if (!sp) return true;
-                return !sp->isActive();
-            }), v.end());
-            live.reserve(v.size());
-            for (auto& w : v) {
-                if (auto sp = w.lock()) live.emplace_back(std::move(sp));
+            if (!v.empty()) {
+                v.erase(std::remove_if(v.begin(), v.end(), [](const std::weak_ptr<IAwaiterEx>& w){
+                    auto sp = w.lock();
+                    if (!sp) return true;
+                    return !sp->isActive();
+                }), v.end());
+                for (auto& w : v) {
+                    if (auto sp = w.lock()) live.emplace_back(std::move(sp));
+                }
+            }
+
+            auto& heap = m_timed_awaiters;
+            if (!heap.empty()) {
+                const auto now = std::chrono::steady_clock::now();
+                while (!heap.empty() && heap.front().deadline <= now) {
+                    std::pop_heap(heap.begin(), heap.end(), TimedAwaiterLater{});
+                    if (auto sp = heap.back().awaiter.lock()) {
+                        if (sp->isActive()) live.emplace_back(std::move(sp));
+                    }
+                    heap.pop_back();
+                }
             }
         }
         for (auto& aw : live) aw->pollTimeout();
+        live.clear();
+    }
+
+    IMGUIX_IMPL_INLINE std::shared_ptr<const EventBus::DispatchBucket>
+    EventBus::makeBucketLocked(EventTypeId type) const {
+        auto it_cb = m_event_callbacks.find(type);
+        auto it_ls = m_event_listeners.find(type);
+        const bool has_callbacks = it_cb != m_event_callbacks.end() && !it_cb->second.empty();
+        const bool has_listeners = it_ls != m_event_listeners.end() && !it_ls->second.empty();
+        if (!has_callbacks && !has_listeners) return nullptr;
+
+        auto bucket = std::make_shared<DispatchBucket>();
+        if (has_callbacks) bucket->callbacks = it_cb->second;
+        if (has_listeners) bucket->listeners = it_ls->second;
+        return bucket;
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::publishDispatchLocked(EventTypeId type) {
+        auto table = std::make_unique<DispatchTable>();
+        if (m_dispatch_owner) {
+            table->buckets = m_dispatch_owner->buckets;
+            table->conflation = m_dispatch_owner->conflation;
+        }
+        if (table->buckets.size() <= type) {
+            table->buckets.resize(static_cast<std::size_t>(type) + 1);
+        }
+        table->buckets[type] = makeBucketLocked(type);
+        swapDispatchLocked(std::move(table));
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::publishDispatchAllLocked() {
+        auto table = std::make_unique<DispatchTable>();
+        if (m_dispatch_owner) {
+            table->buckets.resize(m_dispatch_owner->buckets.size());
+            table->conflation = m_dispatch_owner->conflation;
+        }
+        for (std::size_t i = 0; i < table->buckets.size(); ++i) {
+            table->buckets[i] = makeBucketLocked(static_cast<EventTypeId>(i));
+        }
+        swapDispatchLocked(std::move(table));
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::publishConflationLocked(
+            EventTypeId type,
+            std::shared_ptr<const ConflationRule> rule) {
+        auto table = std::make_unique<DispatchTable>();
+        if (m_dispatch_owner) {
+            table->buckets = m_dispatch_owner->buckets;
+            table->conflation = m_dispatch_owner->conflation;
+        }
+        if (table->conflation.size() <= type) {
+            table->conflation.resize(static_cast<std::size_t>(type) + 1);
+        }
+        table->conflation[type] = std::move(rule);
+        swapDispatchLocked(std::move(table));
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::swapDispatchLocked(std::unique_ptr<const DispatchTable> table) {
+        m_dispatch.store(table.get(), std::memory_order_seq_cst);
+        if (m_dispatch_owner) {
+            m_dispatch_retired.push_back(std::move(m_dispatch_owner));
+            m_has_retired.store(true, std::memory_order_relaxed);
+        }
+        m_dispatch_owner = std::move(table);
+        reclaimDispatchLocked();
+    }
+
+    IMGUIX_IMPL_INLINE void EventBus::reclaimDispatchLocked() {
+        if (m_dispatch_retired.empty()) return;
+        // Any reader that registers after this check loads the newest snapshot.
+        if (m_dispatch_readers.load(std::memory_order_seq_cst) != 0) return;
+        m_dispatch_retired.clear();
+        m_has_retired.store(false, std::memory_order_relaxed);
     }
 
-    IMGUIX_IMPL_INLINE void EventBus::process() {
+    IMGUIX_IMPL_INLINE std::size_t EventBus::process() {
+        m_consumer_thread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+        if (m_has_retired.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
+            reclaimDispatchLocked();
+        }
+
+        std::size_t count = 0;
         std::unique_lock<std::mutex> lock(m_queue_mutex);
-        if (m_event_queue.empty()) {
+        if (!m_event_queue.empty()) {
+            // Swap with a member vector so both buffers keep their capacity between frames.
+            m_process_queue.swap(m_event_queue);
             lock.unlock();
-            pollAwaitersInternal();
-            return;
-        }
 
-        std::queue<std::unique_ptr<Event>> local_queue;
-        std::swap(local_queue, m_event_queue);
-        lock.unlock();
+            for (auto& event : m_process_queue) {
+                notify(event.get());
+            }
+            count += m_process_queue.size();
+            m_process_queue.clear();
+        } else {
+            lock.unlock();
+        }
 
-        while (!local_queue.empty()) {
-            notify(local_queue.front().get());
-            local_queue.pop();
+        if (m_ring) {
+            count += drainBounded();
         }
+        count += drainLatest(m_latest);
 
         pollAwaitersInternal();
+        return count;
     }
 
 } // namespace ImGuiX::Pubsub
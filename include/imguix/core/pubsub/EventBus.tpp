@@ -4,7 +4,7 @@ namespace ImGuiX::Pubsub {
     void EventBus::subscribe(EventListener* owner, std::function<void(const EventType&)> callback) {
         static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
 
-        auto type = std::type_index(typeid(EventType));
+        const EventTypeId type = eventTypeId<EventType>();
         std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
         m_event_callbacks[type].push_back(CallbackRecord{
             owner,
@@ -12,30 +12,33 @@ namespace ImGuiX::Pubsub {
                 callback(*static_cast<const EventType*>(e));
             }
         });
+        publishDispatchLocked(type);
     }
 
     template <typename EventType>
     void EventBus::subscribe(EventListener* owner, std::function<void(const Event* const)> callback) {
         static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
 
-        auto type = std::type_index(typeid(EventType));
+        const EventTypeId type = eventTypeId<EventType>();
         std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
         m_event_callbacks[type].push_back(CallbackRecord{
             owner,
             std::move(callback)
         });
+        publishDispatchLocked(type);
     }
 
     template <typename EventType>
     void EventBus::subscribe(EventListener* listener) {
         static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
 
-        auto type = std::type_index(typeid(EventType));
+        const EventTypeId type = eventTypeId<EventType>();
         std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
         auto& listener_list = m_event_listeners[type];
 
         if (std::find(listener_list.begin(), listener_list.end(), listener) == listener_list.end()) {
             listener_list.push_back(listener);
+            publishDispatchLocked(type);
         }
     }
 
@@ -43,16 +46,19 @@ namespace ImGuiX::Pubsub {
     void EventBus::unsubscribe(EventListener* owner) {
         static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
 
-        auto type = std::type_index(typeid(EventType));
+        const EventTypeId type = eventTypeId<EventType>();
         std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
 
+        bool changed = false;
         auto it_cb = m_event_callbacks.find(type);
         if (it_cb != m_event_callbacks.end()) {
             auto& list = it_cb->second;
-            list.erase(std::remove_if(list.begin(), list.end(),
+            auto new_end = std::remove_if(list.begin(), list.end(),
                 [owner](const CallbackRecord& rec) {
                     return rec.owner == owner;
-                }), list.end());
+                });
+            changed |= new_end != list.end();
+            list.erase(new_end, list.end());
             if (list.empty()) {
                 m_event_callbacks.erase(it_cb);
             }
@@ -61,11 +67,54 @@ namespace ImGuiX::Pubsub {
         auto it_ls = m_event_listeners.find(type);
         if (it_ls != m_event_listeners.end()) {
             auto& list = it_ls->second;
-            list.erase(std::remove(list.begin(), list.end(), owner), list.end());
+            auto new_end = std::remove(list.begin(), list.end(), owner);
+            changed |= new_end != list.end();
+            list.erase(new_end, list.end());
             if (list.empty()) {
                 m_event_listeners.erase(it_ls);
             }
         }
+
+        if (changed) {
+            publishDispatchLocked(type);
+        }
+    }
+
+    template <typename EventType, typename... Args>
+    void EventBus::emplaceAsync(Args&&... args) {
+        static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
+
+        notifyAsync(std::make_unique<EventType>(std::forward<Args>(args)...));
+    }
+
+    template <typename EventType>
+    void EventBus::setLatestWins() {
+        static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
+
+        std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
+        publishConflationLocked(eventTypeId<EventType>(), std::make_shared<ConflationRule>());
+    }
+
+    template <typename EventType>
+    void EventBus::setLatestWins(std::function<std::uint64_t(const EventType&)> key) {
+        static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
+
+        auto rule = std::make_shared<ConflationRule>();
+        if (key) {
+            rule->key = [key = std::move(key)](const Event& e) {
+                return key(static_cast<const EventType&>(e));
+            };
+        }
+        std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
+        publishConflationLocked(eventTypeId<EventType>(), std::move(rule));
+    }
+
+    template <typename EventType>
+    void EventBus::clearLatestWins() {
+        static_assert(std::is_base_of<Event, EventType>::value, u8"EventType must be derived from Event");
+
+        std::lock_guard<std::mutex> lock(m_subscriptions_mutex);
+        publishConflationLocked(eventTypeId<EventType>(), nullptr);
     }
 
 } // namespace ImGuiX::Pubsub
@@ -99,6 +99,14 @@ namespace ImGuiX::Pubsub {
         void notifyAsync(std::unique_ptr<Event> event) {
             m_event_bus->notifyAsync(std::move(event));
         }
+
+        /// \brief Constructs an event in pooled storage and queues it.
+        /// \tparam EventType Type of the event to construct.
+        /// \param args Constructor arguments.
+        template <typename EventType, typename... Args>
+        void emplaceAsync(Args&&... args) {
+            m_event_bus->emplaceAsync<EventType>(std::forward<Args>(args)...);
+        }
         
         // --- Await helpers (optionx semantics; ImGuiX naming) ---
 
@@ -175,6 +183,67 @@ namespace ImGuiX::Pubsub {
             );
         }
 
+        // --- Keyed awaiters (request/response correlation) ---
+
+        /// \brief Set the correlation key extractor used by keyed awaiters of EventType.
+        /// \tparam EventType Event type to index.
+        /// \tparam KeyFn Callable `AwaitKey(const EventType&)`.
+        /// \param key_fn Returns the correlation key of an event (e.g. its request id).
+        /// \note Repeated calls for the same type are ignored.
+        template <typename EventType, typename KeyFn>
+        void setAwaitKey(KeyFn&& key_fn) {
+            std::lock_guard<std::mutex> lk(m_mutex);
+            auto& slot = m_await_indices[eventTypeId<EventType>()];
+            if (slot) return;
+            slot = AwaiterIndex<EventType>::create(
+                *m_event_bus,
+                std::function<AwaitKey(const EventType&)>(std::forward<KeyFn>(key_fn))
+            );
+        }
+
+        /// \brief Await a single EventType whose correlation key equals \p key.
+        /// \details Matching is a hash lookup, independent of the number of pending awaiters.
+        /// \tparam EventType Event type to await; setAwaitKey<EventType>() must be called first.
+        /// \tparam Cb Callback callable type.
+        /// \param key Correlation key to wait for.
+        /// \param cb Callback invoked on match.
+        /// \param opt Await options controlling timeout and cancellation.
+        /// \throws std::logic_error If no key extractor is set for EventType.
+        template <typename EventType, typename Cb>
+        void awaitOnceByKey(AwaitKey key, Cb&& cb, AwaitOptions opt = {}) {
+            opt.single_shot = true;
+            addKeyedAwaiter<EventType>(key, std::forward<Cb>(cb), std::move(opt));
+        }
+
+        /// \brief Await a single keyed EventType with timeout.
+        /// \tparam EventType Event type to await; setAwaitKey<EventType>() must be called first.
+        /// \tparam Cb Callback callable type.
+        /// \param key Correlation key to wait for.
+        /// \param cb Callback invoked on match.
+        /// \param timeout Maximum wait duration.
+        /// \param on_timeout Callback invoked on timeout.
+        template <typename EventType, typename Cb>
+        void awaitOnceByKey(AwaitKey key, Cb&& cb, std::chrono::milliseconds timeout,
+                            std::function<void()> on_timeout = {}) {
+            AwaitOptions opt{};
+            opt.timeout = timeout;
+            opt.on_timeout = std::move(on_timeout);
+            awaitOnceByKey<EventType>(key, std::forward<Cb>(cb), std::move(opt));
+        }
+
+        /// \brief Multi-shot awaiter for events whose correlation key equals \p key.
+        /// \tparam EventType Event type to await; setAwaitKey<EventType>() must be called first.
+        /// \tparam Cb Callback callable type.
+        /// \param key Correlation key to wait for.
+        /// \param cb Callback invoked on each match.
+        /// \param opt Await options controlling timeout and cancellation.
+        /// \return Token to cancel awaiter.
+        template <typename EventType, typename Cb>
+        std::shared_ptr<IAwaiter> awaitEachByKey(AwaitKey key, Cb&& cb, AwaitOptions opt = {}) {
+            opt.single_shot = false;
+            return addKeyedAwaiter<EventType>(key, std::forward<Cb>(cb), std::move(opt));
+        }
+
         // --- Cached latest events for polling in render loops ---
 
         /// \brief Register caching of the latest EventType under a string identifier.
@@ -185,7 +254,7 @@ namespace ImGuiX::Pubsub {
         template <typename EventType, typename Pred = std::function<bool(const EventType&)>>
         void registerCachedEvent(const std::string& id,
                                  Pred&& pred = [](const EventType&) { return true; }) {
-            auto type = std::type_index(typeid(EventType));
+            const EventTypeId type = eventTypeId<EventType>();
             std::unique_ptr<CachedSlot> slot;
             {
                 std::lock_guard<std::mutex> lk(m_cache_mutex);
@@ -240,7 +309,7 @@ namespace ImGuiX::Pubsub {
             auto it = m_cached_events.find(id);
             if (it == m_cached_events.end()) return std::nullopt;
             if (!it->second) return std::nullopt;
-            if (it->second->type != std::type_index(typeid(EventType))) return std::nullopt;
+            if (it->second->type != eventTypeId<EventType>()) return std::nullopt;
             if (!it->second->event) return std::nullopt;
             return *static_cast<const EventType*>(it->second->event.get());
         }
@@ -333,9 +402,11 @@ namespace ImGuiX::Pubsub {
         EventBus* m_event_bus{nullptr}; ///< Associated EventBus instance.
         std::mutex m_mutex;
         std::vector<std::weak_ptr<IAwaiter>> m_awaiters; ///< Weak list of active awaiters
+        std::size_t m_awaiters_prune_at{64};             ///< List size that triggers pruneDeadAwaiters()
+        std::unordered_map<EventTypeId, std::shared_ptr<EventListener>> m_await_indices; ///< AwaiterIndex per type
 
         struct CachedSlot : public EventListener {
-            std::type_index type{typeid(void)};
+            EventTypeId type{kInvalidEventTypeId};
             std::function<bool(const Event* const)> predicate;
             std::unique_ptr<Event> event;
             std::function<void()> unsubscriber;
@@ -344,9 +415,10 @@ namespace ImGuiX::Pubsub {
             std::function<void(const Event*)> handler;
 
             void onEvent(const Event* const e) override {
-                if (predicate(e)) {
-                    event = cloneEvent(e);
-                }
+                if (!predicate(e)) return;
+                // Overwrite the cached copy in place when the type matches.
+                if (event && e->copyTo(*event)) return;
+                event = cloneEvent(e);
             }
 
             std::unique_ptr<Event> cloneEvent(const Event* const e) {
@@ -360,12 +432,46 @@ namespace ImGuiX::Pubsub {
         void pruneDeadAwaiters() {
             std::lock_guard<std::mutex> lk(m_mutex);
             auto& v = m_awaiters;
+            // Amortized: scan only after the list doubled since the last pass.
+            if (v.size() < m_awaiters_prune_at) return;
             v.erase(std::remove_if(v.begin(), v.end(),
                 [](const std::weak_ptr<IAwaiter>& w){
                     if (w.expired()) return true;
                     if (auto sp = w.lock()) return !sp->isActive();
                     return true;
                 }), v.end());
+            m_awaiters_prune_at = std::max<std::size_t>(64, v.size() * 2);
+        }
+
+        template <typename EventType, typename Cb>
+        std::shared_ptr<IAwaiter> addKeyedAwaiter(AwaitKey key, Cb&& cb, AwaitOptions opt) {
+            pruneDeadAwaiters();
+
+            std::shared_ptr<AwaiterIndex<EventType>> index;
+            {
+                std::lock_guard<std::mutex> lk(m_mutex);
+                auto it = m_await_indices.find(eventTypeId<EventType>());
+                if (it != m_await_indices.end()) {
+                    index = std::static_pointer_cast<AwaiterIndex<EventType>>(it->second);
+                }
+            }
+            if (!index) throw std::logic_error(u8"setAwaitKey() was not called for this event type");
+
+            using AW = EventAwaiter<EventType>;
+            auto aw = AW::createKeyed(
+                *m_event_bus,
+                index,
+                key,
+                {},
+                std::function<void(const EventType&)>(std::forward<Cb>(cb)),
+                std::move(opt)
+            );
+
+            m_event_bus->registerAwaiter(std::static_pointer_cast<IAwaiterEx>(aw));
+
+            std::lock_guard<std::mutex> lk(m_mutex);
+            m_awaiters.emplace_back(aw);
+            return aw;
         }
 
         void cancelAllAwaiters() {
@@ -386,10 +492,10 @@ namespace ImGuiX::Pubsub {
         void handleCachedEvent(const EventType& e) {
             std::lock_guard<std::mutex> lk(m_cache_mutex);
             for (auto& [id, slot] : m_cached_events) {
-                if (slot->type != std::type_index(typeid(EventType))) continue;
-                if (slot->predicate(&e)) {
-                    slot->event = std::make_unique<EventType>(e);
-                }
+                if (slot->type != eventTypeId<EventType>()) continue;
+                if (!slot->predicate(&e)) continue;
+                if (slot->event && detail::assignEvent<EventType>(*slot->event, e)) continue;
+                slot->event = std::make_unique<EventType>(e);
             }
         }
     };
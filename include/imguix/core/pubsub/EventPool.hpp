@@ -0,0 +1,240 @@
+#pragma once
+#ifndef _IMGUIX_PUBSUB_EVENT_POOL_HPP_INCLUDED
+#define _IMGUIX_PUBSUB_EVENT_POOL_HPP_INCLUDED
+
+/// \file EventPool.hpp
+/// \brief Size-class pool backing the allocation of Event objects.
+/// \ingroup Core
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#ifndef IMGUIX_PUBSUB_EVENT_POOL
+/// \brief Route Event allocations through EventPool when nonzero.
+#   define IMGUIX_PUBSUB_EVENT_POOL 1
+#endif
+
+namespace ImGuiX::Pubsub {
+
+    /// \brief Counters of the event pool.
+    struct EventPoolStats {
+        std::size_t reserved_bytes{0}; ///< Bytes taken from the heap for pool slabs.
+        std::size_t slab_count{0};     ///< Number of slabs allocated so far.
+    };
+
+    /// \class EventPool
+    /// \brief Process-wide pool of fixed-size blocks for events.
+    /// \details Blocks are grouped in size classes of kGranularity bytes. Each thread
+    ///          keeps a small free list per class; surplus blocks move to a shared
+    ///          list in batches, so producers and the consumer thread rarely touch
+    ///          the shared lock. Memory is taken from the heap in slabs and is never
+    ///          returned, which makes steady-state event traffic heap-free.
+    ///          Requests larger than kMaxBlockSize fall back to ::operator new.
+    ///          Once a thread's cache is destroyed (thread or process exit), that
+    ///          thread allocates from and frees to the shared lists directly.
+    class EventPool {
+    public:
+        static constexpr std::size_t kGranularity = 16;      ///< Size-class step and block alignment.
+        static constexpr std::size_t kMaxBlockSize = 512;    ///< Largest pooled block.
+        static constexpr std::size_t kClassCount = kMaxBlockSize / kGranularity;
+        static constexpr std::size_t kBatchSize = 32;        ///< Blocks moved per transfer and per slab.
+        static constexpr std::size_t kLocalLimit = 2 * kBatchSize; ///< Blocks a thread keeps per class.
+
+        /// \brief Allocate storage for an event.
+        /// \param size Object size in bytes.
+        /// \return Pointer aligned to kGranularity.
+        static void* allocate(std::size_t size) {
+            if (size == 0) size = 1;
+            if (size > kMaxBlockSize) return ::operator new(size);
+
+            const std::size_t cls = classOf(size);
+            LocalCache* local_cache = local();
+            if (!local_cache) return allocateShared(cls);
+            LocalCache& cache = *local_cache;
+            if (!cache.head[cls]) refill(cache, cls);
+            FreeBlock* block = cache.head[cls];
+            cache.head[cls] = block->next;
+            --cache.count[cls];
+            return block;
+        }
+
+        /// \brief Return storage obtained from allocate().
+        /// \param ptr Pointer to release.
+        /// \param size Size passed to allocate().
+        static void deallocate(void* ptr, std::size_t size) noexcept {
+            if (!ptr) return;
+            if (size == 0) size = 1;
+            if (size > kMaxBlockSize) {
+                ::operator delete(ptr);
+                return;
+            }
+
+            const std::size_t cls = classOf(size);
+            auto* block = static_cast<FreeBlock*>(ptr);
+            LocalCache* local_cache = local();
+            if (!local_cache) {
+                deallocateShared(block, cls);
+                return;
+            }
+            LocalCache& cache = *local_cache;
+            block->next = cache.head[cls];
+            cache.head[cls] = block;
+            if (++cache.count[cls] > kLocalLimit) release(cache, cls, kBatchSize);
+        }
+
+        /// \brief Returns pool counters.
+        static EventPoolStats stats() noexcept {
+            EventPoolStats s;
+            s.reserved_bytes = shared().reserved_bytes.load(std::memory_order_relaxed);
+            s.slab_count = shared().slab_count.load(std::memory_order_relaxed);
+            return s;
+        }
+
+    private:
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        struct CentralList {
+            std::mutex mutex;
+            FreeBlock* head{nullptr};
+        };
+
+        struct Shared {
+            CentralList lists[kClassCount];
+            std::atomic<std::size_t> reserved_bytes{0};
+            std::atomic<std::size_t> slab_count{0};
+        };
+
+        struct LocalCache {
+            FreeBlock* head[kClassCount]{};
+            std::size_t count[kClassCount]{};
+
+            ~LocalCache() {
+                for (std::size_t cls = 0; cls < kClassCount; ++cls) {
+                    release(*this, cls, count[cls]);
+                }
+            }
+        };
+
+        static std::size_t classOf(std::size_t size) noexcept {
+            return (size + kGranularity - 1) / kGranularity - 1;
+        }
+
+        static std::size_t blockSize(std::size_t cls) noexcept {
+            return (cls + 1) * kGranularity;
+        }
+
+        /// \brief Shared state; intentionally leaked so events destroyed during
+        ///        static destruction can still be released.
+        static Shared& shared() {
+            static Shared* s_shared = new Shared();
+            return *s_shared;
+        }
+
+        /// \brief Lifetime of the calling thread's cache.
+        enum class CacheState : unsigned char { Unused, Alive, Destroyed };
+
+        /// \brief Trivially destructible, so it is still readable while other
+        ///        thread_local objects are destroyed.
+        static CacheState& cacheState() noexcept {
+            static thread_local CacheState s_state = CacheState::Unused;
+            return s_state;
+        }
+
+        /// \brief Marks the cache destroyed before its blocks are released.
+        struct ThreadCache {
+            LocalCache cache;
+
+            ThreadCache() noexcept { cacheState() = CacheState::Alive; }
+            ~ThreadCache() { cacheState() = CacheState::Destroyed; }
+        };
+
+        /// \brief Cache of the calling thread.
+        /// \return nullptr once the cache was destroyed; events freed by later
+        ///         thread_local or static destructors go to the shared lists.
+        static LocalCache* local() {
+            if (cacheState() == CacheState::Destroyed) return nullptr;
+            static thread_local ThreadCache s_cache;
+            return &s_cache.cache;
+        }
+
+        /// \brief Allocate one block without a thread cache.
+        static void* allocateShared(std::size_t cls) {
+            {
+                CentralList& list = shared().lists[cls];
+                std::lock_guard<std::mutex> lock(list.mutex);
+                if (FreeBlock* block = list.head) {
+                    list.head = block->next;
+                    return block;
+                }
+            }
+            // Take a batch into a temporary cache; its destructor returns the rest.
+            LocalCache temp;
+            refill(temp, cls);
+            FreeBlock* block = temp.head[cls];
+            temp.head[cls] = block->next;
+            --temp.count[cls];
+            return block;
+        }
+
+        /// \brief Free one block without a thread cache.
+        static void deallocateShared(FreeBlock* block, std::size_t cls) noexcept {
+            CentralList& list = shared().lists[cls];
+            std::lock_guard<std::mutex> lock(list.mutex);
+            block->next = list.head;
+            list.head = block;
+        }
+
+        static void refill(LocalCache& cache, std::size_t cls) {
+            CentralList& list = shared().lists[cls];
+            {
+                std::lock_guard<std::mutex> lock(list.mutex);
+                std::size_t n = 0;
+                while (list.head && n < kBatchSize) {
+                    FreeBlock* block = list.head;
+                    list.head = block->next;
+                    block->next = cache.head[cls];
+                    cache.head[cls] = block;
+                    ++n;
+                }
+                cache.count[cls] += n;
+            }
+            if (cache.head[cls]) return;
+
+            const std::size_t size = blockSize(cls);
+            auto* slab = static_cast<unsigned char*>(::operator new(size * kBatchSize));
+            shared().reserved_bytes.fetch_add(size * kBatchSize, std::memory_order_relaxed);
+            shared().slab_count.fetch_add(1, std::memory_order_relaxed);
+            for (std::size_t i = 0; i < kBatchSize; ++i) {
+                auto* block = reinterpret_cast<FreeBlock*>(slab + i * size);
+                block->next = cache.head[cls];
+                cache.head[cls] = block;
+            }
+            cache.count[cls] += kBatchSize;
+        }
+
+        static void release(LocalCache& cache, std::size_t cls, std::size_t n) noexcept {
+            if (n == 0 || !cache.head[cls]) return;
+            FreeBlock* first = cache.head[cls];
+            FreeBlock* last = first;
+            std::size_t moved = 1;
+            while (moved < n && last->next) {
+                last = last->next;
+                ++moved;
+            }
+            cache.head[cls] = last->next;
+            cache.count[cls] -= moved;
+
+            CentralList& list = shared().lists[cls];
+            std::lock_guard<std::mutex> lock(list.mutex);
+            last->next = list.head;
+            list.head = first;
+        }
+    };
+
+} // namespace ImGuiX::Pubsub
+
+#endif // _IMGUIX_PUBSUB_EVENT_POOL_HPP_INCLUDED
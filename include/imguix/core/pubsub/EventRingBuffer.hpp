@@ -0,0 +1,116 @@
+#pragma once
+#ifndef _IMGUIX_PUBSUB_EVENT_RING_BUFFER_HPP_INCLUDED
+#define _IMGUIX_PUBSUB_EVENT_RING_BUFFER_HPP_INCLUDED
+
+/// \file EventRingBuffer.hpp
+/// \brief Bounded lock-free ring buffer used as the EventBus async queue.
+/// \ingroup Core
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "Event.hpp"
+
+namespace ImGuiX::Pubsub {
+
+    /// \class EventRingBuffer
+    /// \brief Bounded multi-producer queue of owned events.
+    /// \details Array-based queue with per-cell sequence numbers (D. Vyukov's
+    ///          bounded queue). Push and pop never take locks or allocate.
+    ///          Pop is safe from several threads, which lets producers evict the
+    ///          oldest element under the drop-oldest policy.
+    class EventRingBuffer {
+    public:
+        /// \brief Create a buffer with at least \p capacity slots.
+        /// \param capacity Requested capacity; rounded up to a power of two (minimum 2).
+        explicit EventRingBuffer(std::size_t capacity) {
+            std::size_t size = 2;
+            while (size < capacity) size <<= 1;
+            m_mask = size - 1;
+            m_cells.reset(new Cell[size]);
+            for (std::size_t i = 0; i < size; ++i) {
+                m_cells[i].seq.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        EventRingBuffer(const EventRingBuffer&) = delete;
+        EventRingBuffer& operator=(const EventRingBuffer&) = delete;
+
+        /// \brief Destroy buffer and any events still queued.
+        ~EventRingBuffer() {
+            while (tryPop()) {}
+        }
+
+        /// \brief Try to enqueue an event.
+        /// \param event Event to enqueue; ownership is taken only on success.
+        /// \return False if the buffer is full.
+        bool tryPush(std::unique_ptr<Event>& event) noexcept {
+            std::size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = m_cells[pos & m_mask];
+                const std::size_t seq = cell.seq.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0) {
+                    if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.value = event.release();
+                        cell.seq.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = m_enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// \brief Try to dequeue the oldest event.
+        /// \return Event or nullptr if the buffer is empty.
+        std::unique_ptr<Event> tryPop() noexcept {
+            std::size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = m_cells[pos & m_mask];
+                const std::size_t seq = cell.seq.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+                if (diff == 0) {
+                    if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        std::unique_ptr<Event> event(cell.value);
+                        cell.value = nullptr;
+                        cell.seq.store(pos + m_mask + 1, std::memory_order_release);
+                        return event;
+                    }
+                } else if (diff < 0) {
+                    return nullptr;
+                } else {
+                    pos = m_dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// \brief Returns the number of slots.
+        std::size_t capacity() const noexcept { return m_mask + 1; }
+
+        /// \brief Returns an approximate number of queued events.
+        /// \note Exact only when no other thread pushes or pops concurrently.
+        std::size_t sizeApprox() const noexcept {
+            const std::size_t deq = m_dequeue_pos.load(std::memory_order_relaxed);
+            const std::size_t enq = m_enqueue_pos.load(std::memory_order_relaxed);
+            return enq > deq ? enq - deq : 0;
+        }
+
+    private:
+        struct Cell {
+            std::atomic<std::size_t> seq{0};
+            Event* value{nullptr};
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        std::size_t m_mask{0};
+        alignas(64) std::atomic<std::size_t> m_enqueue_pos{0}; ///< Next slot for producers.
+        alignas(64) std::atomic<std::size_t> m_dequeue_pos{0}; ///< Next slot for consumers.
+    };
+
+} // namespace ImGuiX::Pubsub
+
+#endif // _IMGUIX_PUBSUB_EVENT_RING_BUFFER_HPP_INCLUDED
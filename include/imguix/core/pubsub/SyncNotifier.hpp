@@ -22,19 +22,38 @@ namespace ImGuiX::Pubsub {
 
         /// \brief Notifies subscribers of an event by raw pointer.
         /// \param event Raw pointer to the event.
-        void notify(const Event *const event) const { m_bus.notify(event); }
+        void notify(const Event *const event) const {
+            if (m_deferred) {
+                if (event) m_bus.notifyAsync(event->clone());
+                return;
+            }
+            m_bus.notify(event);
+        }
 
         /// \brief Notifies subscribers of an event by reference.
         /// \param event Reference to the event.
-        void notify(const Event &event) const { m_bus.notify(event); }
+        void notify(const Event &event) const {
+            if (m_deferred) {
+                m_bus.notifyAsync(event.clone());
+                return;
+            }
+            m_bus.notify(event);
+        }
         
         /// \brief Constructs notifier bound to a specific EventBus.
         /// \param bus Reference to the event bus.
-        explicit SyncNotifier(EventBus &bus) : m_bus(bus) {}
+        /// \param deferred Queue events via notifyAsync instead of dispatching them;
+        ///        used for models processed off the UI thread.
+        explicit SyncNotifier(EventBus &bus, bool deferred = false)
+            : m_bus(bus), m_deferred(deferred) {}
+
+        /// \brief Returns true if events are queued rather than dispatched.
+        bool isDeferred() const noexcept { return m_deferred; }
 
     private:
 
-        EventBus &m_bus; ///< Underlying event bus.
+        EventBus &m_bus;  ///< Underlying event bus.
+        bool m_deferred;  ///< Queue instead of synchronous dispatch.
     };
 
 } // namespace ImGuiX::Pubsub
@@ -6,6 +6,8 @@
 /// \brief Interfaces for cancelable event awaiters.
 /// \ingroup Core
 
+#include <chrono>
+
 namespace ImGuiX::Pubsub {
 
     /// \brief Minimal awaiter interface for mediator bookkeeping.
@@ -25,6 +27,14 @@ namespace ImGuiX::Pubsub {
         /// \brief Poll for timeout or cancellation conditions.
         virtual void pollTimeout() noexcept = 0;
 
+        /// \brief Earliest time at which pollTimeout() has to run.
+        /// \return time_point::min() to be polled on every EventBus::process(),
+        ///         time_point::max() to never be polled, otherwise the deadline.
+        /// \note Queried once when the awaiter is registered.
+        virtual std::chrono::steady_clock::time_point pollDeadline() const noexcept {
+            return std::chrono::steady_clock::time_point::min();
+        }
+
         ~IAwaiterEx() override = default;
     };
 
@@ -6,10 +6,18 @@
 /// \brief Provides a centralized resource registry for managing shared resources.
 /// \ingroup Core
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <typeindex>
 #if defined(__EMSCRIPTEN__)
 #else
@@ -19,15 +27,33 @@
 #include <functional>
 #include <stdexcept>
 
+#include "ResourceTypeId.hpp"
+
 namespace ImGuiX {
 
+    template <typename T>
+    class ResourceHandle;
+
     /// \class ResourceRegistry
     /// \brief Manage registration and access to shared resources in a threadsafe manner.
     /// \thread_safety Thread-safe.
     /// \note Stores type-erased shared resources and ensures only one instance per type.
-    /// \note Access during registration throws or returns `nullopt`.
+    /// \note Creators run without holding the registry lock. While a resource is
+    ///       being created getResource() waits for it and tryGetResource() returns
+    ///       `nullopt`.
+    /// \note Resources live in a flat table indexed by resourceTypeId<T>(); use
+    ///       handle<T>() on hot paths to skip the lock after the first access.
     class ResourceRegistry {
     public:
+        ResourceRegistry() = default;
+
+        /// \brief Finish queued async registrations and stop worker threads.
+        /// \note Registrations still waiting for dependencies are dropped; their
+        ///       futures report `std::future_error` (broken promise).
+        ~ResourceRegistry();
+
+        ResourceRegistry(const ResourceRegistry&) = delete;
+        ResourceRegistry& operator=(const ResourceRegistry&) = delete;
 
         /// \brief Register a resource using a custom creator function.
         /// \tparam T Resource type.
@@ -42,35 +68,202 @@ namespace ImGuiX {
         template <typename T>
         bool registerResource();
 
+        /// \brief Register a resource constructed on a worker thread.
+        /// \tparam T Resource type.
+        /// \tparam Deps Resources that must be ready before \p creator runs.
+        /// \param creator Function returning `shared_ptr<T>`.
+        /// \return Future set to true once the resource is ready, false if it was
+        ///         already registered; holds the creator exception on failure.
+        /// \note Registrations without mutual dependencies build in parallel. A failed
+        ///       dependency fails its dependents. Waits for dependencies that are not
+        ///       registered yet; once every pending registration waits on dependencies
+        ///       and no creator is running, waitAll() and getResource() fail them
+        ///       (never-registered dependency or a cycle).
+        /// \code{.cpp}
+        /// registry.registerResourceAsync<Atlas>(makeAtlas);
+        /// registry.registerResourceAsync<Cache, Atlas>(makeCache); // after Atlas
+        /// registry.waitAll();
+        /// \endcode
+        template <typename T, typename... Deps>
+        std::shared_future<bool> registerResourceAsync(std::function<std::shared_ptr<T>()> creator);
+
+        /// \brief Register a default-constructed resource on a worker thread.
+        /// \tparam T Resource type.
+        /// \tparam Deps Resources that must be ready first.
+        template <typename T, typename... Deps>
+        std::shared_future<bool> registerResourceAsync();
+
+        /// \brief Set the number of threads used by registerResourceAsync().
+        /// \param count Worker count; 0 runs async creators on the registering thread.
+        /// \note Takes effect only before the first async registration.
+        void setAsyncWorkerCount(std::size_t count);
+
+        /// \brief Block until no async registration is queued or running.
+        /// \note Registrations whose dependencies can no longer appear are failed
+        ///       instead of waited for.
+        void waitAll();
+
         /// \brief Get reference to registered resource.
         /// \tparam T Resource type.
         /// \return Reference to resource.
-        /// \throws std::runtime_error if not registered or still initializing.
+        /// \note Waits if the resource is being created on another thread.
+        /// \throws std::runtime_error if not registered, or if called from the
+        ///         creator of the same resource.
         template <typename T>
         [[nodiscard]]
         T& getResource();
 
         /// \brief Try to get reference to a registered resource.
         /// \tparam T Resource type.
-        /// \return Optional reference if available.
+        /// \return Optional reference if available; `nullopt` while still being created.
         template <typename T>
         [[nodiscard]]
         std::optional<std::reference_wrapper<T>> tryGetResource();
 
+        /// \brief Create a cached handle to a resource.
+        /// \tparam T Resource type.
+        /// \return Handle resolved lazily on first access.
+        template <typename T>
+        [[nodiscard]]
+        ResourceHandle<T> handle() noexcept;
+
+        /// \brief Returns a counter bumped whenever resources are removed.
+        /// \details Handles compare it against the value seen at resolution time.
+        std::uint64_t generation() const noexcept {
+            return m_generation.load(std::memory_order_acquire);
+        }
+
         /// \brief Clear all registered resources.
+        /// \note Invalidates every ResourceHandle of this registry. Drops async
+        ///       registrations waiting for dependencies; call it only when no
+        ///       creator is running.
         void clearAll();
 
     private:
-        std::unordered_map<std::type_index, std::shared_ptr<void>> m_resources; ///< Stored resources by type.
-        std::unordered_set<std::type_index> m_in_progress; ///< Types currently being created.
+        template <typename T>
+        friend class ResourceHandle;
+
+        /// \brief Storage of one resource type.
+        struct Slot {
+            std::shared_ptr<void> resource; ///< Owned resource, empty if not registered.
+            bool in_progress{false};        ///< True from registration until the creator returns.
+            bool failed{false};             ///< Last async creation threw.
+            std::thread::id creator;        ///< Thread running the creator, if started.
+        };
+
+        /// \brief Async registration waiting for dependencies or a worker.
+        struct AsyncTask {
+            std::vector<ResourceTypeId> deps;
+            std::function<void(bool)> run; ///< Argument is true if a dependency failed.
+            bool dep_failed{false};
+        };
+
+        /// \brief Look up a resource pointer.
+        /// \param id Resource type ID.
+        /// \param in_progress Set to true if the resource is being created.
+        /// \return Resource pointer or nullptr.
+        void* find(ResourceTypeId id, bool& in_progress) const;
+
+        /// \brief Look up a resource pointer, waiting while it is being created.
+        /// \return Resource pointer or nullptr if not registered.
+        /// \throws std::runtime_error when called from the resource's own creator.
+        /// \note Fails stalled async registrations instead of waiting forever.
+        void* wait(ResourceTypeId id);
+
+        /// \brief Reserve a slot for a new registration.
+        /// \return False if the resource exists or is being created.
+        bool beginCreate(ResourceTypeId id, bool started);
+
+        /// \brief Record the calling thread as the creator of a slot.
+        void markCreator(ResourceTypeId id);
+
+        /// \brief Store the result of a creator and wake dependents and waiters.
+        /// \param resource Created resource; empty on failure.
+        /// \param failed Mark the slot failed so dependents fail too.
+        void finishCreate(ResourceTypeId id, std::shared_ptr<void> resource, bool failed);
+
+        /// \brief Queue an async task, or park it until its dependencies settle.
+        void submit(AsyncTask task);
+
+        /// \brief Move parked tasks with settled dependencies to the run queue.
+        /// \note Requires the exclusive lock.
+        void promoteLocked();
+
+        /// \brief Return true if parked tasks wait on dependencies nothing can register.
+        /// \details All pending tasks are parked and no creator other than the calling
+        ///          thread is running.
+        /// \note Requires the lock.
+        bool stalledLocked() const;
+
+        /// \brief Queue stalled parked tasks as failed and run them where needed.
+        void releaseStalled();
+
+        /// \brief Run queued tasks on the calling thread when there are no workers.
+        void drainInline();
+
+        void startWorkersLocked();
+        void workerLoop();
+
+        std::vector<Slot> m_slots; ///< Resources indexed by ResourceTypeId.
+        std::atomic<std::uint64_t> m_generation{1}; ///< Bumped by clearAll().
+
+        std::deque<AsyncTask> m_queue;   ///< Tasks ready to run.
+        std::vector<AsyncTask> m_parked; ///< Tasks waiting for dependencies.
+        std::size_t m_async_pending{0};  ///< Queued, parked and running tasks.
+        std::vector<std::thread> m_workers;
+        #if defined(__EMSCRIPTEN__)
+        std::size_t m_worker_count{0};   ///< Requested workers; threads start lazily.
+        #else
+        std::size_t m_worker_count{std::max(1u, std::min(4u, std::thread::hardware_concurrency()))};
+        #endif
+        bool m_workers_started{false};
+        bool m_stop{false};
 
         #if defined(__EMSCRIPTEN__)
-        mutable std::mutex m_resources_mutex; ///< Protects resource map.
-        mutable std::mutex m_progress_mutex;  ///< Protects initialization set.
+        mutable std::mutex m_mutex;        ///< Protects slots and async state.
         #else
-        mutable std::shared_mutex m_resources_mutex; ///< Protects resource map.
-        mutable std::shared_mutex m_progress_mutex;  ///< Protects initialization set.
+        mutable std::shared_mutex m_mutex; ///< Protects slots and async state.
         #endif
+        mutable std::condition_variable_any m_ready_cv; ///< Signals finished creators.
+        std::condition_variable_any m_work_cv;          ///< Wakes async workers.
+    };
+
+    /// \class ResourceHandle
+    /// \brief Cached typed access to a registry resource.
+    /// \tparam T Resource type.
+    /// \details The first access looks the resource up under the registry lock and
+    ///          caches the pointer with the registry generation. Later accesses
+    ///          compare one atomic counter and return the cached pointer, so the
+    ///          per-frame cost is a pointer load. clearAll() bumps the generation
+    ///          and forces the next access to resolve again.
+    /// \note A handle is a small value type; give each thread its own copy.
+    template <typename T>
+    class ResourceHandle {
+    public:
+        ResourceHandle() = default;
+
+        /// \brief Bind the handle to a registry.
+        /// \param registry Registry that owns the resource.
+        explicit ResourceHandle(ResourceRegistry& registry) noexcept
+            : m_registry(&registry) {}
+
+        /// \brief Returns the resource, waiting while it is being created.
+        /// \throws std::runtime_error if not registered.
+        T& get();
+
+        /// \brief Returns the resource or nullptr if it is not available yet.
+        T* tryGet();
+
+        T& operator*() { return get(); }
+        T* operator->() { return &get(); }
+
+        /// \brief Returns true if the handle is bound to a registry.
+        explicit operator bool() const noexcept { return m_registry != nullptr; }
+
+    private:
+        ResourceRegistry* m_registry{nullptr};
+        T* m_ptr{nullptr};
+        std::uint64_t m_generation{0}; ///< Registry generation of m_ptr; 0 if unresolved.
     };
 
 } // namespace ImGuiX
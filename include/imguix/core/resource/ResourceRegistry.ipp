@@ -1,12 +1,235 @@
 namespace ImGuiX {
 
-    inline void ResourceRegistry::clearAll() {
-        std::unique_lock progress_lock(m_progress_mutex, std::defer_lock);
-        std::unique_lock resource_lock(m_resources_mutex, std::defer_lock);
-        std::lock(progress_lock, resource_lock);
+    inline ResourceRegistry::~ResourceRegistry() {
+        {
+            std::unique_lock lock(m_mutex);
+            m_stop = true;
+        }
+        m_work_cv.notify_all();
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    inline void* ResourceRegistry::find(ResourceTypeId id, bool& in_progress) const {
+#if defined(__EMSCRIPTEN__)
+        std::unique_lock<std::mutex> lock(m_mutex);
+#else
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+#endif
+        if (id >= m_slots.size()) {
+            in_progress = false;
+            return nullptr;
+        }
+        const Slot& slot = m_slots[id];
+        in_progress = slot.in_progress;
+        return in_progress ? nullptr : slot.resource.get();
+    }
+
+    inline void* ResourceRegistry::wait(ResourceTypeId id) {
+        for (;;) {
+            {
+#if defined(__EMSCRIPTEN__)
+                std::unique_lock<std::mutex> lock(m_mutex);
+#else
+                std::shared_lock<std::shared_mutex> lock(m_mutex);
+#endif
+                for (;;) {
+                    if (id >= m_slots.size()) return nullptr;
+                    const Slot& slot = m_slots[id];
+                    if (!slot.in_progress) return slot.resource.get();
+                    if (slot.creator == std::this_thread::get_id()) {
+                        throw std::runtime_error(u8"Resource is being initialized");
+                    }
+                    if (stalledLocked()) break;
+                    m_ready_cv.wait(lock);
+                }
+            }
+            // Nothing can register the missing dependencies; fail the parked tasks.
+            releaseStalled();
+        }
+    }
+
+    inline bool ResourceRegistry::beginCreate(ResourceTypeId id, bool started) {
+        std::unique_lock lock(m_mutex);
+        if (id >= m_slots.size()) m_slots.resize(id + 1);
+        Slot& slot = m_slots[id];
+        if (slot.in_progress || slot.resource) {
+            return false;
+        }
+        slot.in_progress = true;
+        slot.failed = false;
+        slot.creator = started ? std::this_thread::get_id() : std::thread::id{};
+        return true;
+    }
+
+    inline void ResourceRegistry::markCreator(ResourceTypeId id) {
+        std::unique_lock lock(m_mutex);
+        if (id < m_slots.size()) m_slots[id].creator = std::this_thread::get_id();
+    }
+
+    inline void ResourceRegistry::finishCreate(
+            ResourceTypeId id,
+            std::shared_ptr<void> resource,
+            bool failed) {
+        {
+            std::unique_lock lock(m_mutex);
+            if (id >= m_slots.size()) m_slots.resize(id + 1);
+            Slot& slot = m_slots[id];
+            slot.resource = std::move(resource);
+            slot.in_progress = false;
+            slot.failed = failed;
+            slot.creator = std::thread::id{};
+            promoteLocked();
+        }
+        m_ready_cv.notify_all();
+        m_work_cv.notify_all();
+        drainInline();
+    }
+
+    inline void ResourceRegistry::submit(AsyncTask task) {
+        {
+            std::unique_lock lock(m_mutex);
+            if (!m_workers_started) startWorkersLocked();
+            ++m_async_pending;
+            m_parked.push_back(std::move(task));
+            promoteLocked();
+        }
+        m_work_cv.notify_all();
+        drainInline();
+    }
+
+    inline void ResourceRegistry::promoteLocked() {
+        auto settled = [this](const AsyncTask& task, bool& failed) {
+            failed = false;
+            for (ResourceTypeId dep : task.deps) {
+                if (dep >= m_slots.size()) return false;
+                const Slot& slot = m_slots[dep];
+                if (slot.failed) {
+                    failed = true;
+                    continue;
+                }
+                if (slot.in_progress || !slot.resource) return false;
+            }
+            return true;
+        };
+        for (std::size_t i = 0; i < m_parked.size();) {
+            bool failed = false;
+            if (!settled(m_parked[i], failed)) {
+                ++i;
+                continue;
+            }
+            m_parked[i].dep_failed = failed;
+            m_queue.push_back(std::move(m_parked[i]));
+            m_parked[i] = std::move(m_parked.back());
+            m_parked.pop_back();
+        }
+    }
 
-        m_resources.clear();
-        m_in_progress.clear();
+    inline bool ResourceRegistry::stalledLocked() const {
+        // Every pending task is parked, so only a creator still running can settle them.
+        if (m_parked.empty() || !m_queue.empty() || m_async_pending != m_parked.size()) {
+            return false;
+        }
+        const std::thread::id self = std::this_thread::get_id();
+        for (const Slot& slot : m_slots) {
+            // Async slots that have not started carry no creator; ours cannot finish
+            // while we wait.
+            if (slot.in_progress && slot.creator != std::thread::id{} && slot.creator != self) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline void ResourceRegistry::releaseStalled() {
+        {
+            std::unique_lock lock(m_mutex);
+            if (!stalledLocked()) return;
+            for (auto& task : m_parked) {
+                task.dep_failed = true;
+                m_queue.push_back(std::move(task));
+            }
+            m_parked.clear();
+        }
+        m_work_cv.notify_all();
+        drainInline();
+    }
+
+    inline void ResourceRegistry::drainInline() {
+        for (;;) {
+            AsyncTask task;
+            {
+                std::unique_lock lock(m_mutex);
+                if (!m_workers.empty() || m_queue.empty()) return;
+                task = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+            task.run(task.dep_failed);
+            {
+                std::unique_lock lock(m_mutex);
+                --m_async_pending;
+            }
+            m_ready_cv.notify_all();
+        }
+    }
+
+    inline void ResourceRegistry::setAsyncWorkerCount(std::size_t count) {
+        std::unique_lock lock(m_mutex);
+        if (!m_workers_started) m_worker_count = count;
+    }
+
+    inline void ResourceRegistry::startWorkersLocked() {
+        m_workers_started = true;
+        m_workers.reserve(m_worker_count);
+        for (std::size_t i = 0; i < m_worker_count; ++i) {
+            m_workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    inline void ResourceRegistry::workerLoop() {
+        for (;;) {
+            AsyncTask task;
+            {
+                std::unique_lock lock(m_mutex);
+                m_work_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+                // Finish queued work before stopping so started registrations complete.
+                if (m_queue.empty()) return;
+                task = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+            task.run(task.dep_failed);
+            {
+                std::unique_lock lock(m_mutex);
+                --m_async_pending;
+            }
+            m_ready_cv.notify_all();
+        }
+    }
+
+    inline void ResourceRegistry::waitAll() {
+        for (;;) {
+            {
+                std::unique_lock lock(m_mutex);
+                m_ready_cv.wait(lock, [this] { return m_async_pending == 0 || stalledLocked(); });
+                if (m_async_pending == 0) return;
+            }
+            releaseStalled();
+        }
+    }
+
+    inline void ResourceRegistry::clearAll() {
+        std::vector<Slot> old;
+        std::vector<AsyncTask> parked;
+        {
+            std::unique_lock lock(m_mutex);
+            m_generation.fetch_add(1, std::memory_order_acq_rel);
+            old.swap(m_slots);
+            parked.swap(m_parked);
+            m_async_pending -= parked.size();
+        }
+        m_ready_cv.notify_all();
+        // Destroy resources outside the lock; destructors may use the registry.
     }
 
 } // namespace ImGuiX
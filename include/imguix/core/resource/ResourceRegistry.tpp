@@ -11,24 +11,19 @@ namespace ImGuiX {
 
     template <typename T>
     bool ResourceRegistry::registerResource(std::function<std::shared_ptr<T>()> creator) {
-        const std::type_index type = typeid(T);
-
-        std::scoped_lock lock(m_progress_mutex, m_resources_mutex);
-        if (!m_in_progress.insert(type).second) {
-            return false;
-        }
-        if (m_resources.find(type) != m_resources.end()) {
-            m_in_progress.erase(type);
+        const ResourceTypeId id = resourceTypeId<T>();
+        if (!beginCreate(id, true)) {
             return false;
         }
+        std::shared_ptr<void> resource;
         try {
-            m_resources[type] = creator();
-            m_in_progress.erase(type);
-            return true;
+            resource = creator();
         } catch (...) {
-            m_in_progress.erase(type);
+            finishCreate(id, nullptr, false);
             throw;
         }
+        finishCreate(id, std::move(resource), false);
+        return true;
     }
 
     template <typename T>
@@ -36,58 +31,111 @@ namespace ImGuiX {
         return registerResource<T>([] { return std::make_shared<T>(); });
     }
 
-    template <typename T>
-    T& ResourceRegistry::getResource() {
-        const std::type_index type = typeid(T);
-
-#if defined(__EMSCRIPTEN__)
-        std::unique_lock<std::mutex> progress_lock(m_progress_mutex);
-#else
-        std::shared_lock<std::shared_mutex> progress_lock(m_progress_mutex);
-#endif
-        if (m_in_progress.find(type) != m_in_progress.end()) {
-            throw std::runtime_error(u8"Resource is being initialized");
+    template <typename T, typename... Deps>
+    std::shared_future<bool> ResourceRegistry::registerResourceAsync(
+            std::function<std::shared_ptr<T>()> creator) {
+        const ResourceTypeId id = resourceTypeId<T>();
+        auto promise = std::make_shared<std::promise<bool>>();
+        std::shared_future<bool> future = promise->get_future().share();
+        if (!beginCreate(id, false)) {
+            promise->set_value(false);
+            return future;
         }
-        progress_lock.unlock();
 
-#if defined(__EMSCRIPTEN__)
-        std::unique_lock<std::mutex> resource_lock(m_resources_mutex);
-#else
-        std::shared_lock<std::shared_mutex> resource_lock(m_resources_mutex);
-#endif
-        auto it = m_resources.find(type);
-        if (it == m_resources.end()) {
+        AsyncTask task;
+        task.deps = {resourceTypeId<Deps>()...};
+        task.run = [this, id, creator = std::move(creator), promise](bool dep_failed) {
+            std::shared_ptr<void> resource;
+            std::exception_ptr error;
+            if (dep_failed) {
+                error = std::make_exception_ptr(std::runtime_error(u8"Resource dependency failed"));
+            } else {
+                markCreator(id);
+                try {
+                    resource = creator();
+                    if (!resource) {
+                        error = std::make_exception_ptr(std::runtime_error(u8"Resource creator returned null"));
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+            finishCreate(id, std::move(resource), error != nullptr);
+            if (error) {
+                promise->set_exception(error);
+            } else {
+                promise->set_value(true);
+            }
+        };
+        submit(std::move(task));
+        return future;
+    }
+
+    template <typename T, typename... Deps>
+    std::shared_future<bool> ResourceRegistry::registerResourceAsync() {
+        return registerResourceAsync<T, Deps...>([] { return std::make_shared<T>(); });
+    }
+
+    template <typename T>
+    T& ResourceRegistry::getResource() {
+        void* ptr = wait(resourceTypeId<T>());
+        if (!ptr) {
             throw std::runtime_error(u8"Resource not registered");
         }
-
-        return *static_cast<T*>(it->second.get());
+        return *static_cast<T*>(ptr);
     }
 
     template <typename T>
     std::optional<std::reference_wrapper<T>> ResourceRegistry::tryGetResource() {
-        const std::type_index type = typeid(T);
-
-#if defined(__EMSCRIPTEN__)
-        std::unique_lock<std::mutex> progress_lock(m_progress_mutex);
-#else
-        std::shared_lock<std::shared_mutex> progress_lock(m_progress_mutex);
-#endif
-        if (m_in_progress.find(type) != m_in_progress.end()) {
+        bool in_progress = false;
+        void* ptr = find(resourceTypeId<T>(), in_progress);
+        if (!ptr) {
             return std::nullopt;
         }
-        progress_lock.unlock();
+        return std::ref(*static_cast<T*>(ptr));
+    }
 
-#if defined(__EMSCRIPTEN__)
-        std::unique_lock<std::mutex> resource_lock(m_resources_mutex);
-#else
-        std::shared_lock<std::shared_mutex> resource_lock(m_resources_mutex);
-#endif
-        auto it = m_resources.find(type);
-        if (it == m_resources.end()) {
-            return std::nullopt;
+    template <typename T>
+    ResourceHandle<T> ResourceRegistry::handle() noexcept {
+        return ResourceHandle<T>(*this);
+    }
+
+    template <typename T>
+    T& ResourceHandle<T>::get() {
+        if (m_generation != 0 && m_generation == m_registry->generation()) {
+            return *m_ptr;
+        }
+        if (!m_registry) {
+            throw std::runtime_error(u8"Resource handle is not bound");
+        }
+        const std::uint64_t generation = m_registry->generation();
+        T* ptr = static_cast<T*>(m_registry->wait(resourceTypeId<T>()));
+        if (!ptr) {
+            throw std::runtime_error(u8"Resource not registered");
         }
+        m_ptr = ptr;
+        m_generation = generation;
+        return *ptr;
+    }
 
-        return std::ref(*static_cast<T*>(it->second.get()));
+    template <typename T>
+    T* ResourceHandle<T>::tryGet() {
+        if (m_generation != 0 && m_generation == m_registry->generation()) {
+            return m_ptr;
+        }
+        if (!m_registry) return nullptr;
+        // Read the generation first so a concurrent clearAll() is never missed.
+        const std::uint64_t generation = m_registry->generation();
+        bool in_progress = false;
+        T* ptr = static_cast<T*>(m_registry->find(resourceTypeId<T>(), in_progress));
+        if (ptr) {
+            m_ptr = ptr;
+            m_generation = generation;
+        } else {
+            m_ptr = nullptr;
+            m_generation = 0;
+        }
+        return ptr;
     }
 
 } // namespace ImGuiX
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef _IMGUIX_CORE_RESOURCE_TYPE_ID_HPP_INCLUDED
+#define _IMGUIX_CORE_RESOURCE_TYPE_ID_HPP_INCLUDED
+
+/// \file ResourceTypeId.hpp
+/// \brief Dense identifiers of resource types used by ResourceRegistry.
+/// \ingroup Core
+
+#include <cstdint>
+#include <typeindex>
+
+namespace ImGuiX {
+
+    /// \brief Dense per-process identifier of a resource type.
+    using ResourceTypeId = std::uint32_t;
+
+    namespace detail {
+
+        /// \brief Map a runtime type to its dense resource ID, assigning one on first use.
+        /// \param type Resource type.
+        /// \return Dense resource type ID.
+        /// \note Slow path guarded by a mutex; resourceTypeId<T>() caches the result per type.
+        ///       Defined in ResourceTypeId.ipp so a compiled library and the modules
+        ///       linking it share one registry.
+        ResourceTypeId resourceTypeIdOf(const std::type_index& type);
+
+    } // namespace detail
+
+    /// \brief Returns the dense ID of resource type \p T.
+    /// \tparam T Resource type.
+    /// \return ID resolved once per type and then read from a function-local static.
+    template <typename T>
+    ResourceTypeId resourceTypeId() noexcept {
+        static const ResourceTypeId s_id = detail::resourceTypeIdOf(std::type_index(typeid(T)));
+        return s_id;
+    }
+
+} // namespace ImGuiX
+
+#ifdef IMGUIX_HEADER_ONLY
+#   include "ResourceTypeId.ipp"
+#endif
+
+#endif // _IMGUIX_CORE_RESOURCE_TYPE_ID_HPP_INCLUDED
@@ -0,0 +1,108 @@
+#pragma once
+#ifndef _IMGUIX_CORE_WINDOW_FRAME_PACER_HPP_INCLUDED
+#define _IMGUIX_CORE_WINDOW_FRAME_PACER_HPP_INCLUDED
+
+/// \file FramePacer.hpp
+/// \brief Frame scheduling of a single window.
+/// \ingroup Core
+
+#include <imguix/config/frame.hpp>
+
+#include <atomic>
+#include <chrono>
+
+namespace ImGuiX {
+
+    /// \brief When a window renders new frames.
+    enum class RedrawMode {
+        Continuous, ///< Every frame, limited by the target FPS.
+        OnDemand    ///< Only after input or requestRedraw().
+    };
+
+    /// \class FramePacer
+    /// \brief Decides when a window renders its next frame.
+    /// \details Continuous windows are due once per target-FPS interval. On-demand
+    ///          windows are due only while frames are owed: each markInput() owes
+    ///          IMGUIX_REDRAW_FRAMES frames, paced at the same interval.
+    /// \note markInput() is thread-safe; call the rest from the main loop thread.
+    class FramePacer {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        /// \brief Limit the frame rate.
+        /// \param fps Frames per second; 0 or less removes the limit.
+        void setTargetFps(int fps) noexcept {
+            m_target_fps = fps > 0 ? fps : 0;
+        }
+
+        /// \brief Return the frame rate limit; 0 when unlimited.
+        int targetFps() const noexcept {
+            return m_target_fps;
+        }
+
+        /// \brief Select the redraw mode and owe frames so the switch is shown.
+        /// \param mode Redraw mode.
+        void setMode(RedrawMode mode) noexcept {
+            m_mode = mode;
+            markInput();
+        }
+
+        /// \brief Return the redraw mode.
+        RedrawMode mode() const noexcept {
+            return m_mode;
+        }
+
+        /// \brief Owe IMGUIX_REDRAW_FRAMES frames after input or a redraw request.
+        void markInput() noexcept {
+            m_redraw_frames.store(IMGUIX_REDRAW_FRAMES, std::memory_order_relaxed);
+        }
+
+        /// \brief Return the number of frames still owed in on-demand mode.
+        int pendingFrames() const noexcept {
+            return m_redraw_frames.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Return true if a frame should be rendered at \p now.
+        /// \param now Current time.
+        bool isDue(clock::time_point now) const noexcept {
+            return now >= m_next_frame && wantsFrames();
+        }
+
+        /// \brief Return the earliest time a frame may be due.
+        /// \return time_point::max() while an on-demand window owes no frames.
+        clock::time_point nextTime() const noexcept {
+            return wantsFrames() ? m_next_frame : clock::time_point::max();
+        }
+
+        /// \brief Schedule the next frame and pay one owed frame.
+        /// \param now Time the rendered frame was started.
+        void finish(clock::time_point now) noexcept {
+            if (m_target_fps > 0) {
+                const auto interval = std::chrono::duration_cast<clock::duration>(
+                    std::chrono::seconds(1)) / m_target_fps;
+                // Keep the cadence after a late frame, but never schedule a burst.
+                m_next_frame += interval;
+                if (m_next_frame < now) m_next_frame = now + interval;
+            } else {
+                m_next_frame = now;
+            }
+
+            int frames = m_redraw_frames.load(std::memory_order_relaxed);
+            while (frames > 0 && !m_redraw_frames.compare_exchange_weak(
+                    frames, frames - 1, std::memory_order_relaxed)) {}
+        }
+
+    private:
+        int m_target_fps = IMGUIX_DEFAULT_TARGET_FPS;           ///< Frame rate limit, 0 for none.
+        RedrawMode m_mode = RedrawMode::Continuous;             ///< When new frames are rendered.
+        std::atomic<int> m_redraw_frames{IMGUIX_REDRAW_FRAMES}; ///< Frames still owed in on-demand mode.
+        clock::time_point m_next_frame{};                       ///< Earliest start of the next frame.
+
+        bool wantsFrames() const noexcept {
+            return m_mode == RedrawMode::Continuous || pendingFrames() > 0;
+        }
+    };
+
+} // namespace ImGuiX
+
+#endif // _IMGUIX_CORE_WINDOW_FRAME_PACER_HPP_INCLUDED
@@ -1,6 +1,7 @@
 #ifdef _WIN32
 #   include <windows.h>
 #endif
+#include <imgui_internal.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 #include <GLFW/glfw3.h>
@@ -43,7 +44,9 @@ namespace ImGuiX {
     bool WindowInstance::create() {
         if (m_window || m_is_open) return true;
         if (!glfwInit()) return false;
-        m_window = glfwCreateWindow(width(), height(), name().c_str(), nullptr, nullptr);
+        // Shared GL objects, see IMGUIX_FONTS_SHARED_ATLAS.
+        GLFWwindow* share = glfwGetCurrentContext();
+        m_window = glfwCreateWindow(width(), height(), name().c_str(), nullptr, share);
         if (!m_window) return false;
         
         glfwMakeContextCurrent(m_window);
@@ -108,6 +111,7 @@ namespace ImGuiX {
     void WindowInstance::handleEvents() {
         if (!m_window) return;
         glfwPollEvents();
+        if (m_imgui_ctx && !m_imgui_ctx->InputEventsQueue.empty()) markInput();
         if (glfwWindowShouldClose(m_window)) {
             Events::WindowClosedEvent evt(id(), name());
             notify(evt);
@@ -117,6 +121,18 @@ namespace ImGuiX {
         }
     }
 
+    void WindowInstance::waitEvents(std::chrono::milliseconds timeout) {
+        if (!m_window) return;
+        const auto start = std::chrono::steady_clock::now();
+        glfwWaitEventsTimeout(std::chrono::duration<double>(timeout).count());
+        // Resize, focus and similar events do not reach the ImGui input queue.
+        if (std::chrono::steady_clock::now() - start < timeout) markInput();
+    }
+
+    void WindowInstance::wakeEventLoop() {
+        glfwPostEmptyEvent();
+    }
+
     void WindowInstance::tick() {
         if (!m_window) return;
         setCurrentWindow();
@@ -58,6 +58,8 @@ namespace ImGuiX {
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
+        // Shared GL objects, see IMGUIX_FONTS_SHARED_ATLAS.
+        SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
         
         m_gl_context = SDL_GL_CreateContext(m_window);
         SDL_GL_MakeCurrent(m_window, m_gl_context);
@@ -126,6 +128,7 @@ namespace ImGuiX {
     void WindowInstance::handleEvents() {
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
+            markInput();
             ImGui_ImplSDL2_ProcessEvent(&event);
             if (event.type == SDL_QUIT) {
                 close();
@@ -133,6 +136,18 @@ namespace ImGuiX {
         }
     }
 
+    void WindowInstance::waitEvents(std::chrono::milliseconds timeout) {
+        if (!m_window) return;
+        // Leaves the event queued for handleEvents().
+        SDL_WaitEventTimeout(nullptr, static_cast<int>(timeout.count()));
+    }
+
+    void WindowInstance::wakeEventLoop() {
+        SDL_Event wake{};
+        wake.type = SDL_USEREVENT;
+        SDL_PushEvent(&wake);
+    }
+
     void WindowInstance::tick() {
         if (!m_window) return;
         setCurrentWindow();
@@ -104,7 +104,7 @@ namespace ImGuiX {
     bool WindowInstance::create() {
         if (m_window.isOpen() || m_is_open) return true;
         m_window.create(sf::VideoMode({static_cast<unsigned int>(width()),  static_cast<unsigned int>(height())}), name());
-        m_window.setFramerateLimit(60);
+        // Frame rate is paced by WindowManager, see setTargetFps().
         m_is_open = ImGui::SFML::Init(m_window);
         ImGui::SFML::SetCurrentWindow(m_window);
 
@@ -156,18 +156,36 @@ namespace ImGuiX {
     void WindowInstance::handleEvents() {
         setCurrentWindow();
         while (const auto event = m_window.pollEvent()) {
-            ImGui::SFML::ProcessEvent(m_window, *event);
-            if (event->is<sf::Event::Closed>() && m_window.isOpen()) {
-                Events::WindowClosedEvent evt(id(), name());
-                notify(evt);
-                m_window.close();
-            }
+            processSfmlEvent(*event);
+        }
+    }
+
+    void WindowInstance::processSfmlEvent(const sf::Event& event) {
+        markInput();
+        ImGui::SFML::ProcessEvent(m_window, event);
+        if (event.is<sf::Event::Closed>() && m_window.isOpen()) {
+            Events::WindowClosedEvent evt(id(), name());
+            notify(evt);
+            m_window.close();
         }
     }
 
+    void WindowInstance::waitEvents(std::chrono::milliseconds timeout) {
+        if (!m_window.isOpen()) return;
+        setCurrentWindow();
+        const auto ms = static_cast<std::int32_t>(timeout.count());
+        if (const auto event = m_window.waitEvent(sf::milliseconds(ms))) {
+            processSfmlEvent(*event);
+        }
+    }
+
+    void WindowInstance::wakeEventLoop() {
+        // SFML cannot interrupt waitEvent(); the wait timeout bounds the latency.
+    }
+
     void WindowInstance::tick() {
         setCurrentWindow();
-        auto& res = registry().getResource<DeltaClockSfml>();
+        auto& res = m_delta_clock.get();
         ImGui::SFML::Update(m_window, res.delta());
         m_window.clear();
         updateCurrentTheme();
@@ -34,6 +34,7 @@
 #endif
 
 #include "WindowInterface.hpp"
+#include <chrono>
 #include <filesystem>
 #include <imguix/config/paths.hpp>
 #include <memory>
@@ -181,6 +182,49 @@ namespace ImGuiX {
         /// \brief Return true if the window is open.
         /// \return True while the window exists.
         bool isOpen() const override;
+
+        /// \copydoc WindowInterface::setTargetFps
+        void setTargetFps(int fps) override;
+
+        /// \copydoc WindowInterface::targetFps
+        int targetFps() const override;
+
+        /// \copydoc WindowInterface::setRedrawMode
+        void setRedrawMode(RedrawMode mode) override;
+
+        /// \copydoc WindowInterface::redrawMode
+        RedrawMode redrawMode() const override;
+
+        /// \copydoc WindowInterface::requestRedraw
+        void requestRedraw() override;
+
+        /// \copydoc WindowInterface::setRedrawOnEvents
+        void setRedrawOnEvents(bool enable) override;
+
+        /// \copydoc WindowInterface::redrawOnEvents
+        bool redrawOnEvents() const override;
+
+        // --- Frame pacing ---
+
+        /// \brief Return true if the window should render a frame now.
+        /// \param now Current time.
+        /// \note Internal use.
+        bool isFrameDue(std::chrono::steady_clock::time_point now) const;
+
+        /// \brief Return the earliest time the window may need a frame.
+        /// \return time_point::max() while an on-demand window is idle.
+        /// \note Internal use.
+        std::chrono::steady_clock::time_point nextFrameTime() const;
+
+        /// \brief Schedule the next frame after present().
+        /// \param now Time the frame was started.
+        /// \note Internal use.
+        void finishFrame(std::chrono::steady_clock::time_point now);
+
+        /// \brief Block until input arrives or \p timeout elapses.
+        /// \param timeout Longest wait.
+        /// \note Internal use; events are consumed by the next handleEvents().
+        virtual void waitEvents(std::chrono::milliseconds timeout);
         
         /// \brief Make the window context current for rendering.
         /// \note Call only between frames before ImGui::NewFrame().
@@ -233,10 +277,12 @@ namespace ImGuiX {
         
         /// \brief Request window to switch its UI language.
         /// \param lang Language code.
+        /// \note Loads the language in the background; the switch happens in
+        ///       applyPendingLanguageChange() once it is ready.
         void requestLanguageChange(const std::string& lang);
         
-        /// \brief Apply pending language change.
-        /// \note Internal use.
+        /// \brief Apply pending language change if its strings are loaded.
+        /// \note Internal use. Called at the start of every frame; never parses.
         void applyPendingLanguageChange();
         
         /// \brief Start font initialization.
@@ -247,6 +293,11 @@ namespace ImGuiX {
         /// \note Internal use.
         void buildFonts();
 
+        /// \brief Swap in a font atlas rebuilt in the background, pick up a shared
+        ///        atlas rebuilt by another window and keep a dynamic atlas within its budget.
+        /// \note Internal use. Called at the start of every frame.
+        void syncFonts();
+
         // --- Themes ---
 
         /// \brief Access the theme manager.
@@ -298,6 +349,20 @@ namespace ImGuiX {
         /// \param locale Locale identifier.
         void fontsSetLocale(std::string locale);
 
+        /// \brief Bake glyphs when text first uses them instead of preloading ranges.
+        /// \param enabled True for on-demand glyphs (ImGui 1.92+). Default: IMGUIX_FONTS_DYNAMIC_GLYPHS.
+        void fontsSetDynamicGlyphs(bool enabled);
+
+        /// \brief Rasterize rebuilt font atlases on a worker thread.
+        /// \param enabled True to keep the old atlas on screen until the new one is ready
+        ///        (ImGui < 1.92). Default: IMGUIX_FONTS_BACKGROUND_REBUILD.
+        /// \note Ignored unless imconfig.h makes GImGui thread-local.
+        void fontsSetBackgroundRebuild(bool enabled);
+
+        /// \brief Share the font atlas with windows of identical font configuration.
+        /// \param enabled True to share. Default: IMGUIX_FONTS_SHARED_ATLAS.
+        void fontsSetSharedAtlas(bool enabled);
+
         /// \brief Select preset character ranges.
         /// \param preset '+'-separated named or numeric tokens.
         void fontsSetRangesPreset(std::string preset);
@@ -359,7 +424,12 @@ namespace ImGuiX {
         bool m_is_visible = true;           ///< Visibility flag.
 
         ApplicationContext& m_application;  ///< Reference to the owning application.
+        mutable ResourceHandle<OptionsStore> m_options; ///< Cached OptionsStore access.
+#ifdef IMGUIX_USE_SFML_BACKEND
+        ResourceHandle<DeltaClockSfml> m_delta_clock;   ///< Cached frame clock access.
+#endif
         std::vector<std::unique_ptr<Controller>> m_controllers; ///< Attached controllers.
+        std::vector<std::size_t> m_controller_stages;   ///< Profiler stage per controller, by type.
         std::vector<Controller*> m_pending_controllers; ///< Controllers awaiting onInit.
         std::filesystem::path m_ini_path;   ///< Path to the window-specific ImGui ini file.
         bool m_is_ini_once = false;         ///< Ensures imgui ini is saved only once.
@@ -370,11 +440,26 @@ namespace ImGuiX {
         bool m_is_fonts_init = false;       ///< Indicates whether fonts have been built.
         ImGuiX::Fonts::FontManager m_font_manager;    ///< Manages ImGui font atlas.
         ImGuiX::Themes::ThemeManager m_theme_manager; ///< Manages ImGui style themes.
-        ImGuiX::I18N::LangStore    m_lang_store{};    ///< Localization storage for this window.
+        ImGuiX::I18N::LangStore    m_lang_store;      ///< View over the shared LangCatalog.
         std::string                m_pending_lang;    ///< Language code pending to apply.
         ImGuiX::Notify::NotificationManager m_notification_manager{}; ///< Toast notifications manager.
 
 
+        FramePacer m_frame_pacer;           ///< Target FPS and redraw mode.
+        bool m_redraw_on_events = false;    ///< Redraw after dispatched bus events.
+
+        /// \brief Schedule redraw frames after input.
+        void markInput() noexcept;
+
+        /// \brief Wake a thread blocked in waitEvents() (no-op if the backend cannot).
+        void wakeEventLoop();
+
+#ifdef IMGUIX_USE_SFML_BACKEND
+        /// \brief Forward an SFML event to ImGui and handle window closing.
+        /// \param event Event polled from the window.
+        void processSfmlEvent(const sf::Event& event);
+#endif
+
         /// \brief Hook before applying requested language.
         /// \param lang Language code to apply.
         virtual void onBeforeLanguageApply(const std::string& lang) { (void)lang; }
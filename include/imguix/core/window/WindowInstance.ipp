@@ -9,26 +9,94 @@ namespace ImGuiX {
         : EventMediator(app.eventBus()),
           m_window_id(id),
           m_window_name(std::move(name)),
-          m_application(app) {
+          m_application(app),
+          m_options(app.registry().handle<OptionsStore>()),
+          m_lang_store([&app] {
+              // One catalog per application; each window only keeps a view.
+              auto& registry = app.registry();
+              registry.registerResource<ImGuiX::I18N::LangCatalog>();
+              return registry.getResource<ImGuiX::I18N::LangCatalog>().shared_from_this();
+          }()) {
+#       ifdef IMGUIX_USE_SFML_BACKEND
+        m_delta_clock = app.registry().handle<DeltaClockSfml>();
+#       endif
+        {
+            // One atlas cache per application; used when the shared-atlas mode is on.
+            auto& registry = app.registry();
+            registry.registerResource<ImGuiX::Fonts::FontAtlasCache>();
+            m_font_manager.setAtlasCache(registry.getResource<ImGuiX::Fonts::FontAtlasCache>().shared_from_this());
+        }
         m_theme_manager.registerTheme("light", std::make_unique<Themes::LightTheme>());
         m_theme_manager.registerTheme("dark", std::make_unique<Themes::DarkTheme>());
     }
 
     void WindowInstance::drawContent() {
         setCurrentWindow();
-        for (auto& ctrl : m_controllers) {
-            ctrl->drawContent();
+        for (std::size_t i = 0; i < m_controllers.size(); ++i) {
+            IMGUIX_PROFILE_SCOPE_ID(m_controller_stages[i]);
+            m_controllers[i]->drawContent();
         }
     }
 
     void WindowInstance::drawUi() {
         setCurrentWindow();
-        for (auto& ctrl : m_controllers) {
-            ctrl->drawUi();
+        for (std::size_t i = 0; i < m_controllers.size(); ++i) {
+            IMGUIX_PROFILE_SCOPE_ID(m_controller_stages[i]);
+            m_controllers[i]->drawUi();
         }
         notifications().render();
     }
 
+    void WindowInstance::setTargetFps(int fps) {
+        m_frame_pacer.setTargetFps(fps);
+    }
+
+    int WindowInstance::targetFps() const {
+        return m_frame_pacer.targetFps();
+    }
+
+    void WindowInstance::setRedrawMode(RedrawMode mode) {
+        m_frame_pacer.setMode(mode);
+    }
+
+    RedrawMode WindowInstance::redrawMode() const {
+        return m_frame_pacer.mode();
+    }
+
+    void WindowInstance::requestRedraw() {
+        markInput();
+        wakeEventLoop();
+    }
+
+    void WindowInstance::setRedrawOnEvents(bool enable) {
+        m_redraw_on_events = enable;
+    }
+
+    bool WindowInstance::redrawOnEvents() const {
+        return m_redraw_on_events;
+    }
+
+    void WindowInstance::markInput() noexcept {
+        m_frame_pacer.markInput();
+    }
+
+    bool WindowInstance::isFrameDue(std::chrono::steady_clock::time_point now) const {
+        return isOpen() && m_frame_pacer.isDue(now);
+    }
+
+    std::chrono::steady_clock::time_point WindowInstance::nextFrameTime() const {
+        if (!isOpen()) return std::chrono::steady_clock::time_point::max();
+        return m_frame_pacer.nextTime();
+    }
+
+    void WindowInstance::finishFrame(std::chrono::steady_clock::time_point now) {
+        m_frame_pacer.finish(now);
+
+        // Text cursors and toasts animate without input.
+        if (ImGui::GetCurrentContext() && ImGui::GetIO().WantTextInput) markInput();
+        if (!m_notification_manager.empty()) markInput();
+    }
+
     void WindowInstance::initializePendingControllers() {
         setCurrentWindow();
         for (auto* ctrl : m_pending_controllers) {
@@ -68,11 +136,11 @@ namespace ImGuiX {
     }
 
     OptionsStore::Control& WindowInstance::options() {
-        return m_application.registry().getResource<OptionsStore>().control();
+        return m_options->control();
     }
 
     const OptionsStore::View& WindowInstance::options() const {
-        return m_application.registry().getResource<OptionsStore>().view();
+        return m_options->view();
     }
     
     ApplicationContext& WindowInstance::application() {
@@ -186,16 +254,23 @@ namespace ImGuiX {
     }
     
     void WindowInstance::requestLanguageChange(const std::string& lang) {
-        if (!lang.empty()) m_pending_lang = lang;
+        if (lang.empty()) return;
+        m_pending_lang = lang;
+        m_lang_store.preload(lang); // разбор каталога в фоне
     }
     
     void WindowInstance::applyPendingLanguageChange() {
         if (m_pending_lang.empty()) return;
+        if (!m_lang_store.is_language_ready(m_pending_lang)) {
+            requestRedraw(); // продолжать кадры, пока язык грузится
+            return;
+        }
         setCurrentWindow();                        // активировать контекст окна
         onBeforeLanguageApply(m_pending_lang);     // виртуальный хук (пересборка шрифтов и т.п.)
         m_lang_store.set_language(m_pending_lang); // фактическая смена языка
         m_font_manager.rebuildIfNeeded();
         m_pending_lang.clear();
+        requestRedraw();
     }
     
     // ---
@@ -217,6 +292,20 @@ namespace ImGuiX {
         m_font_manager.setLocale(std::move(locale));
     }
     
+    void WindowInstance::fontsSetDynamicGlyphs(bool enabled) {
+        assert(m_in_init_phase && u8"fontsSetDynamicGlyphs() только в onInit()");
+        m_font_manager.setDynamicGlyphs(enabled);
+    }
+
+    void WindowInstance::fontsSetBackgroundRebuild(bool enabled) {
+        m_font_manager.setBackgroundRebuild(enabled);
+    }
+
+    void WindowInstance::fontsSetSharedAtlas(bool enabled) {
+        assert(m_in_init_phase && u8"fontsSetSharedAtlas() только в onInit()");
+        m_font_manager.setSharedAtlas(enabled);
+    }
+
     void WindowInstance::fontsSetRangesPreset(std::string preset) {
         assert(m_in_init_phase && u8"fontsSetRangesPreset() только в onInit()");
         m_font_manager.setRanges(std::move(preset));
@@ -273,4 +362,26 @@ namespace ImGuiX {
             notify(IMGUIX_LOG_EVENT(ImGuiX::Events::LogLevel::Error, u8"Font init failed: {}"));
         }
     }
+
+    void WindowInstance::syncFonts() {
+        if (!m_is_fonts_init) return;
+        if (m_font_manager.isRebuildPending()) {
+            if (m_font_manager.isRebuildReady()) {
+                setCurrentWindow();
+                auto br = m_font_manager.applyRebuild();
+                if (!br.success) {
+                    notify(IMGUIX_LOG_EVENT(ImGuiX::Events::LogLevel::Error, u8"Font rebuild failed: " + br.message));
+                }
+            }
+            requestRedraw(); // продолжать кадры, пока атлас собирается в фоне
+        }
+        if (m_font_manager.isSharedAtlasStale()) {
+            setCurrentWindow();
+            m_font_manager.rebuildIfNeeded();
+        }
+        if (m_font_manager.isAtlasOverBudget()) {
+            setCurrentWindow();
+            m_font_manager.trimAtlas();
+        }
+    }
 }
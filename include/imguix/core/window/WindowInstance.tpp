@@ -14,6 +14,7 @@ namespace ImGuiX {
         ControllerType& ref = *ptr;
         m_pending_controllers.push_back(ptr);
         m_controllers.push_back(std::move(ctrl));
+        m_controller_stages.push_back(IMGUIX_PROFILE_TYPE_STAGE(ControllerType));
         return ref;
     }
 
@@ -10,6 +10,8 @@
 #   include <SFML/Graphics/RenderWindow.hpp>
 #endif
 
+#include "FramePacer.hpp"
+
 struct ImFont;
 
 namespace ImGuiX {
@@ -99,6 +101,34 @@ namespace ImGuiX {
         /// \return True while the window exists.
         virtual bool isOpen() const = 0;
 
+        /// \brief Limit the frame rate of the window.
+        /// \param fps Frames per second; 0 removes the limit.
+        virtual void setTargetFps(int fps) = 0;
+
+        /// \brief Return the frame rate limit of the window.
+        /// \return Frames per second; 0 when unlimited.
+        virtual int targetFps() const = 0;
+
+        /// \brief Select when the window renders new frames.
+        /// \param mode Redraw mode.
+        virtual void setRedrawMode(RedrawMode mode) = 0;
+
+        /// \brief Return the redraw mode of the window.
+        /// \return Current redraw mode.
+        virtual RedrawMode redrawMode() const = 0;
+
+        /// \brief Ask for new frames in on-demand mode (e.g. while animating).
+        /// \note Thread-safe; wakes the main loop where the backend allows it.
+        virtual void requestRedraw() = 0;
+
+        /// \brief Redraw the window whenever the main loop dispatched bus events.
+        /// \param enable True to opt in; off by default, handlers call requestRedraw().
+        virtual void setRedrawOnEvents(bool enable) = 0;
+
+        /// \brief Return true if dispatched bus events redraw the window.
+        /// \return True when opted in with setRedrawOnEvents().
+        virtual bool redrawOnEvents() const = 0;
+
         /// \brief Provide access to the global event bus.
         /// \return Reference to the EventBus.
         virtual Pubsub::EventBus& eventBus() = 0;
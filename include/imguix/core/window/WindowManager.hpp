@@ -39,8 +39,18 @@ namespace ImGuiX {
         void initIniAll();
 
         /// \brief Execute full frame processing sequence.
+        /// \details Renders only windows whose frame is due (target FPS, redraw mode).
+        ///          When none is due, blocks on the backend until input arrives or the
+        ///          earliest frame deadline passes (at most IMGUIX_IDLE_WAIT_TIMEOUT_MS).
         void processFrame();
 
+        /// \brief Request redraw of every window.
+        void requestRedrawAll();
+
+        /// \brief Request redraw of windows opted in with setRedrawOnEvents().
+        /// \note Called after the main loop dispatched bus events.
+        void requestRedrawOnEvents();
+
         /// \brief Get number of managed windows.
         /// \return Number of windows.
         std::size_t windowCount() const;
@@ -66,7 +76,16 @@ namespace ImGuiX {
         void drawContentAll();
 
         /// \brief Forward present to all windows.
-        void presentAll();
+        /// \param now Start time of the frame.
+        void presentAll(std::chrono::steady_clock::time_point now);
+
+        /// \brief Collect windows that render this frame.
+        /// \param now Current time.
+        void collectDueWindows(std::chrono::steady_clock::time_point now);
+
+        /// \brief Block until input or the next frame deadline.
+        /// \param now Current time.
+        void waitForFrame(std::chrono::steady_clock::time_point now);
 
         /// \brief Load ImGui settings for all windows.
         void loadIniAll();
@@ -93,7 +112,11 @@ namespace ImGuiX {
         std::vector<std::unique_ptr<WindowInstance>> m_windows;      ///< Managed windows.
         std::vector<std::unique_ptr<WindowInstance>> m_pending_add;  ///< Newly created windows waiting to be added.
         std::vector<WindowInstance*> m_pending_init;                 ///< Windows pending initialization.
+        std::vector<WindowInstance*> m_frame_windows;                ///< Windows rendered in the current frame.
         ApplicationContext&          m_application;                  ///< Reference to the owning application.
+#ifdef IMGUIX_USE_SFML_BACKEND
+        ResourceHandle<DeltaClockSfml> m_delta_clock;                ///< Cached frame clock access.
+#endif
         std::deque<Events::LangChangeEvent> m_lang_events;           ///< Queued language change events.
         int                          m_ini_save_frame_counter{0};    ///< Frame counter for ini saving.
         static constexpr int         m_ini_save_interval{300};       ///< Frames between ini saves.
@@ -102,9 +125,12 @@ namespace ImGuiX {
         /// \return Reference to the ResourceRegistry owned by the application.
         ResourceRegistry& registry();
 
-        /// \brief Process queued language change events.
+        /// \brief Process queued language change events and apply languages that finished loading.
         void processLanguageEvents();
 
+        /// \brief Let windows pick up shared font atlases rebuilt by other windows.
+        void syncFontsAll();
+
         /// \brief Find window by identifier.
         /// \param id Window identifier.
         /// \return Window pointer or nullptr.
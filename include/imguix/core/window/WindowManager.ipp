@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <thread>
 
 #include <imgui.h>
 
@@ -7,6 +9,9 @@ namespace ImGuiX {
 
     WindowManager::WindowManager(ApplicationContext& app)
         : EventMediator(app.eventBus()), m_application(app) {
+#       ifdef IMGUIX_USE_SFML_BACKEND
+        m_delta_clock = app.registry().handle<DeltaClockSfml>();
+#       endif
         subscribe<Events::ApplicationExitEvent>();
         subscribe<Events::LangChangeEvent>();
     }
@@ -78,18 +83,26 @@ namespace ImGuiX {
             if (ev.apply_to_all) {
                 for (auto& window : m_windows) {
                     window->requestLanguageChange(ev.lang);
-                    window->applyPendingLanguageChange();
                 }
             } else {
                 auto* window = findWindowById(ev.window_id);
                 if (window) {
                     window->requestLanguageChange(ev.lang);
-                    window->applyPendingLanguageChange();
                 }
             }
         }
+        // Swap in languages whose background load has finished (frame boundary).
+        for (auto& window : m_windows) {
+            window->applyPendingLanguageChange();
+        }
     }
     
+    void WindowManager::syncFontsAll() {
+        for (auto& window : m_windows) {
+            window->syncFonts();
+        }
+    }
+
     void WindowManager::initIniAll() {
         for (auto& window : m_windows) {
             window->initIni();
@@ -116,46 +129,127 @@ namespace ImGuiX {
     }
 
     void WindowManager::tickAll() {
-        processLanguageEvents();
+        if (m_frame_windows.empty()) return;
 
 #       ifdef IMGUIX_USE_SFML_BACKEND
-        registry().getResource<DeltaClockSfml>().update();
+        m_delta_clock->update();
 #       endif
 
-        for (auto& window : m_windows) {
+        for (auto* window : m_frame_windows) {
             window->tick();
         }
     }
 
     void WindowManager::drawUiAll() {
-        for (auto& window : m_windows) {
+        for (auto* window : m_frame_windows) {
             if (!window->isOpen()) continue;
             window->drawUi();
         }
     }
 
     void WindowManager::drawContentAll() {
-        for (auto& window : m_windows) {
+        for (auto* window : m_frame_windows) {
             if (!window->isOpen()) continue;
             window->drawContent();
         }
     }
 
-    void WindowManager::presentAll() {
-        for (auto& window : m_windows) {
+    void WindowManager::presentAll(std::chrono::steady_clock::time_point now) {
+        for (auto* window : m_frame_windows) {
             if (!window->isOpen()) continue;
             window->present();
+            window->finishFrame(now);
+        }
+    }
+
+    void WindowManager::collectDueWindows(std::chrono::steady_clock::time_point now) {
+        m_frame_windows.clear();
+        for (auto& window : m_windows) {
+            if (window->isFrameDue(now)) m_frame_windows.push_back(window.get());
+        }
+    }
+
+    void WindowManager::waitForFrame(std::chrono::steady_clock::time_point now) {
+#       ifdef __EMSCRIPTEN__
+        // The browser drives the loop; blocking would stall it.
+        (void)now;
+#       else
+        auto wake = now + std::chrono::milliseconds(IMGUIX_IDLE_WAIT_TIMEOUT_MS);
+        WindowInstance* waiter = nullptr;
+        bool on_demand = false;
+        for (auto& window : m_windows) {
+            if (!window->isOpen()) continue;
+            if (!waiter) waiter = window.get();
+            if (window->redrawMode() == RedrawMode::OnDemand) on_demand = true;
+            wake = std::min(wake, window->nextFrameTime());
+        }
+        if (!waiter || wake <= now) return;
+
+        if (on_demand) {
+            // Input must cut the wait short; backends poll events globally
+            // except SFML, where other windows are picked up after the timeout.
+            waiter->waitEvents(std::chrono::ceil<std::chrono::milliseconds>(wake - now));
+        } else {
+            std::this_thread::sleep_until(wake);
+        }
+#       endif
+    }
+
+    void WindowManager::requestRedrawAll() {
+        for (auto& window : m_windows) {
+            window->requestRedraw();
+        }
+    }
+
+    void WindowManager::requestRedrawOnEvents() {
+        for (auto& window : m_windows) {
+            if (window->redrawOnEvents()) window->requestRedraw();
         }
     }
 
     void WindowManager::processFrame() {
-        handleEvents();
-        tickAll();
-        drawContentAll();
-        drawUiAll();
-        presentAll();
-        loadIniAll();
-        saveIniAll();
+        {
+            IMGUIX_PROFILE_SCOPE("handleEvents");
+            handleEvents();
+            processLanguageEvents();
+            syncFontsAll();
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        collectDueWindows(now);
+        if (m_frame_windows.empty()) {
+            {
+                IMGUIX_PROFILE_IDLE_SCOPE("wait");
+                waitForFrame(now);
+            }
+            IMGUIX_PROFILE_SCOPE("handleEvents");
+            handleEvents();
+            now = std::chrono::steady_clock::now();
+            collectDueWindows(now);
+        }
+
+        {
+            IMGUIX_PROFILE_SCOPE("tick");
+            tickAll();
+        }
+        {
+            IMGUIX_PROFILE_SCOPE("drawContent");
+            drawContentAll();
+        }
+        {
+            IMGUIX_PROFILE_SCOPE("drawUi");
+            drawUiAll();
+        }
+        {
+            IMGUIX_PROFILE_SCOPE("present");
+            presentAll(now);
+        }
+        {
+            IMGUIX_PROFILE_SCOPE("ini");
+            loadIniAll();
+            // The save interval counts rendered frames, not idle wakeups.
+            if (!m_frame_windows.empty()) saveIniAll();
+        }
     }
 
     void WindowManager::removeClosed() {
@@ -30,6 +30,11 @@ namespace ImGuiX::Events {
             return typeid(MetricsPlotSetUpdateEvent);
         }
 
+        /// \copydoc Pubsub::Event::typeId
+        Pubsub::EventTypeId typeId() const override {
+            return Pubsub::eventTypeId<MetricsPlotSetUpdateEvent>();
+        }
+
         /// \copydoc Pubsub::Event::name
         const char* name() const override {
             return u8"MetricsPlotSetUpdateEvent";
@@ -39,6 +44,11 @@ namespace ImGuiX::Events {
         std::unique_ptr<Event> clone() const override {
             return std::make_unique<MetricsPlotSetUpdateEvent>(*this);
         }
+
+        /// \copydoc Pubsub::Event::copyTo
+        bool copyTo(Pubsub::Event& target) const override {
+            return Pubsub::detail::assignEvent<MetricsPlotSetUpdateEvent>(target, *this);
+        }
     };
 
 } // namespace ImGuiX::Events
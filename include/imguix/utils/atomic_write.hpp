@@ -0,0 +1,27 @@
+#pragma once
+#ifndef _IMGUIX_UTILS_ATOMIC_WRITE_HPP_INCLUDED
+#define _IMGUIX_UTILS_ATOMIC_WRITE_HPP_INCLUDED
+
+/// \file atomic_write.hpp
+/// \brief Replace a file in one step (temporary file + rename).
+
+#include <cstddef>
+#include <filesystem>
+
+namespace ImGuiX::Utils {
+
+    /// \brief Write \p size bytes to \p path through a temporary file and a rename.
+    /// \param path Destination; missing parent directories are created.
+    /// \param data Bytes to write.
+    /// \param size Number of bytes.
+    /// \return True if \p path now holds the bytes.
+    /// \note Readers see either the old or the new file. The temporary name is
+    ///       unique per process and thread, so concurrent writers of one path
+    ///       do not clobber each other's partial files. No fsync.
+    bool writeFileAtomic(const std::filesystem::path& path, const void* data, std::size_t size) noexcept;
+
+} // namespace ImGuiX::Utils
+
+#include "atomic_write.ipp"
+
+#endif // _IMGUIX_UTILS_ATOMIC_WRITE_HPP_INCLUDED
@@ -0,0 +1,50 @@
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if defined(_WIN32)
+#   include <process.h>
+#else
+#   include <unistd.h>
+#endif
+
+namespace ImGuiX::Utils {
+
+    inline bool writeFileAtomic(const std::filesystem::path& path, const void* data, std::size_t size) noexcept {
+        namespace fs = std::filesystem;
+        static std::atomic<unsigned> s_counter{0};
+        fs::path tmp = path;
+        try {
+            if (!path.parent_path().empty()) {
+                std::error_code ec;
+                fs::create_directories(path.parent_path(), ec);
+            }
+#           if defined(_WIN32)
+            const auto pid = static_cast<unsigned long>(::_getpid());
+#           else
+            const auto pid = static_cast<unsigned long>(::getpid());
+#           endif
+            tmp += u8"." + std::to_string(pid) + u8"-"
+                 + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + u8"-"
+                 + std::to_string(s_counter.fetch_add(1, std::memory_order_relaxed)) + u8".tmp";
+            {
+                std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+                if (!f.good()) return false;
+                f.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+                f.flush();
+                if (!f.good()) throw std::runtime_error(u8"write failed");
+            }
+            fs::rename(tmp, path);
+            return true;
+        } catch (...) {
+            std::error_code ec;
+            fs::remove(tmp, ec);
+            return false;
+        }
+    }
+
+} // namespace ImGuiX::Utils
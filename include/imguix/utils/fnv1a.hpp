@@ -0,0 +1,42 @@
+#pragma once
+#ifndef _IMGUIX_UTILS_FNV1A_HPP_INCLUDED
+#define _IMGUIX_UTILS_FNV1A_HPP_INCLUDED
+
+/// \file fnv1a.hpp
+/// \brief Incremental 64-bit FNV-1a hash for cache keys and fingerprints.
+/// \note Not cryptographic; values depend on byte order and type sizes.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ImGuiX::Utils {
+
+    /// \class Fnv1a
+    /// \brief Accumulates bytes into a 64-bit FNV-1a hash.
+    class Fnv1a {
+    public:
+        /// \brief Mix \p size bytes at \p data into the hash.
+        void add(const void* data, std::size_t size) noexcept {
+            const auto* p = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                m_hash ^= p[i];
+                m_hash *= 1099511628211ull;
+            }
+        }
+
+        /// \brief Mix the object representation of a trivially copyable value.
+        template <typename T>
+        void addPod(const T& value) noexcept {
+            add(&value, sizeof(value));
+        }
+
+        /// \brief Current hash value.
+        std::uint64_t value() const noexcept { return m_hash; }
+
+    private:
+        std::uint64_t m_hash = 14695981039346656037ull; ///< FNV-1a offset basis.
+    };
+
+} // namespace ImGuiX::Utils
+
+#endif // _IMGUIX_UTILS_FNV1A_HPP_INCLUDED
@@ -0,0 +1,72 @@
+#pragma once
+#ifndef _IMGUIX_UTILS_MAPPED_FILE_HPP_INCLUDED
+#define _IMGUIX_UTILS_MAPPED_FILE_HPP_INCLUDED
+
+/// \file mapped_file.hpp
+/// \brief Read-only memory-mapped file.
+/// \note On Emscripten the file is read into memory instead.
+
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace ImGuiX::Utils {
+
+    /// \class MappedFile
+    /// \brief Maps a whole file read-only for the lifetime of the object.
+    class MappedFile {
+    public:
+        MappedFile() = default;
+
+        /// \brief Map \p path; check is_open() for success.
+        explicit MappedFile(const std::filesystem::path& path) { open(path); }
+
+        ~MappedFile() { close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept { swap(other); }
+
+        MappedFile& operator=(MappedFile&& other) noexcept {
+            if (this != &other) {
+                close();
+                swap(other);
+            }
+            return *this;
+        }
+
+        /// \brief Map a file, unmapping the previous one.
+        /// \param path File to map.
+        /// \return True on success; empty files fail.
+        bool open(const std::filesystem::path& path) noexcept;
+
+        /// \brief Release the mapping.
+        void close() noexcept;
+
+        /// \brief Start of the mapped bytes or nullptr.
+        const unsigned char* data() const noexcept { return m_data; }
+
+        /// \brief Number of mapped bytes.
+        std::size_t size() const noexcept { return m_size; }
+
+        /// \brief True if a file is mapped.
+        bool is_open() const noexcept { return m_data != nullptr; }
+
+    private:
+        void swap(MappedFile& other) noexcept;
+
+        const unsigned char* m_data{nullptr};
+        std::size_t m_size{0};
+#if defined(__EMSCRIPTEN__)
+        std::vector<unsigned char> m_buffer; ///< File contents; no mmap on the web.
+#elif defined(_WIN32)
+        void* m_mapping{nullptr};            ///< HANDLE of the file mapping.
+#endif
+    };
+
+} // namespace ImGuiX::Utils
+
+#include "mapped_file.ipp"
+
+#endif // _IMGUIX_UTILS_MAPPED_FILE_HPP_INCLUDED
@@ -0,0 +1,105 @@
+#include <fstream>
+#include <utility>
+
+#if defined(__EMSCRIPTEN__)
+#elif defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <Windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace ImGuiX::Utils {
+
+    inline bool MappedFile::open(const std::filesystem::path& path) noexcept {
+        close();
+#if defined(__EMSCRIPTEN__)
+        try {
+            std::ifstream f(path, std::ios::binary | std::ios::ate);
+            if (!f.good()) return false;
+            const auto size = static_cast<std::size_t>(f.tellg());
+            if (size == 0) return false;
+            m_buffer.resize(size);
+            f.seekg(0);
+            f.read(reinterpret_cast<char*>(m_buffer.data()), static_cast<std::streamsize>(size));
+            if (!f.good()) {
+                m_buffer.clear();
+                return false;
+            }
+            m_data = m_buffer.data();
+            m_size = size;
+            return true;
+        } catch (...) {
+            m_buffer.clear();
+            return false;
+        }
+#elif defined(_WIN32)
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file); // the mapping keeps the file open
+        if (!mapping) return false;
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            return false;
+        }
+        m_mapping = mapping;
+        m_data = static_cast<const unsigned char*>(view);
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        return true;
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps the file open
+        if (view == MAP_FAILED) return false;
+        m_data = static_cast<const unsigned char*>(view);
+        m_size = static_cast<std::size_t>(st.st_size);
+        return true;
+#endif
+    }
+
+    inline void MappedFile::close() noexcept {
+        if (!m_data) return;
+#if defined(__EMSCRIPTEN__)
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+#elif defined(_WIN32)
+        UnmapViewOfFile(m_data);
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        m_mapping = nullptr;
+#else
+        ::munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    inline void MappedFile::swap(MappedFile& other) noexcept {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+#if defined(__EMSCRIPTEN__)
+        m_buffer.swap(other.m_buffer);
+#elif defined(_WIN32)
+        std::swap(m_mapping, other.m_mapping);
+#endif
+    }
+
+} // namespace ImGuiX::Utils
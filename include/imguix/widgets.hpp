@@ -26,6 +26,7 @@
 #include <imguix/widgets/input/virtual_keyboard.hpp>
 #include <imguix/widgets/input/virtual_keyboard_overlay.hpp>
 
+#include <imguix/widgets/misc/frame_profiler_overlay.hpp>
 #include <imguix/widgets/misc/loading_spinner.hpp>
 #include <imguix/widgets/misc/markers.hpp>
 #include <imguix/widgets/misc/text_center.hpp>
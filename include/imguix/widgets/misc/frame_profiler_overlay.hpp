@@ -0,0 +1,51 @@
+#pragma once
+#ifndef _IMGUIX_WIDGETS_FRAME_PROFILER_OVERLAY_HPP_INCLUDED
+#define _IMGUIX_WIDGETS_FRAME_PROFILER_OVERLAY_HPP_INCLUDED
+
+/// \file frame_profiler_overlay.hpp
+/// \brief Table and graph of FrameProfiler stage timings.
+
+#include <imgui.h>
+#include <imguix/core/profiler/FrameProfiler.hpp>
+
+namespace ImGuiX::Widgets {
+
+    /// \brief Configuration for FrameProfilerOverlay.
+    struct FrameProfilerOverlayConfig {
+        bool  show_table   = true;   ///< Draw per-stage statistics.
+        bool  show_graph   = true;   ///< Draw frame-time history.
+        float graph_height = 60.0f;  ///< Graph height in pixels.
+        float budget_ms    = 16.67f; ///< Frame budget line; <= 0 hides it (ImPlot only).
+        bool  use_implot   = true;   ///< Use ImPlot when IMGUIX_ENABLE_IMPLOT is defined.
+    };
+
+    /// \brief Draw profiler statistics into the current window.
+    /// \param id Unique widget identifier.
+    /// \param cfg Overlay parameters.
+    /// \note Shows a hint when built without IMGUIX_ENABLE_PROFILER.
+    /// \code{.cpp}
+    /// ImGui::Begin("Profiler");
+    /// FrameProfilerOverlay("profiler");
+    /// ImGui::End();
+    /// \endcode
+    void FrameProfilerOverlay(const char* id, const FrameProfilerOverlayConfig& cfg = {});
+
+#   ifdef IMGUIX_DEMO
+    /// \brief Render demo for FrameProfilerOverlay widget.
+    /// \param cfg Overlay configuration.
+    inline void DemoFrameProfilerOverlay(FrameProfilerOverlayConfig& cfg) {
+        ImGui::Checkbox("table", &cfg.show_table);
+        ImGui::SameLine();
+        ImGui::Checkbox("graph", &cfg.show_graph);
+        ImGui::SliderFloat("budget, ms", &cfg.budget_ms, 0.0f, 50.0f, "%.2f");
+        FrameProfilerOverlay("profiler", cfg);
+    }
+#   endif
+
+} // namespace ImGuiX::Widgets
+
+#ifdef IMGUIX_HEADER_ONLY
+#   include "frame_profiler_overlay.ipp"
+#endif
+
+#endif // _IMGUIX_WIDGETS_FRAME_PROFILER_OVERLAY_HPP_INCLUDED
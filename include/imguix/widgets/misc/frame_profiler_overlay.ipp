@@ -0,0 +1,77 @@
+#include <imguix/config/build.hpp>
+#include <cstdio>
+#include <vector>
+
+#ifdef IMGUIX_ENABLE_IMPLOT
+#   include <implot.h>
+#endif
+
+namespace ImGuiX::Widgets {
+
+    IMGUIX_IMPL_INLINE void FrameProfilerOverlay(const char* id, const FrameProfilerOverlayConfig& cfg) {
+        using Profiling::FrameProfiler;
+#       if !IMGUIX_ENABLE_PROFILER
+        (void)cfg;
+        ImGui::PushID(id);
+        ImGui::TextDisabled("Profiler disabled (IMGUIX_ENABLE_PROFILER=0)");
+        ImGui::PopID();
+#       else
+        const FrameProfiler& profiler = FrameProfiler::instance();
+        ImGui::PushID(id);
+
+        if (cfg.show_graph && profiler.historySize() > 0) {
+            // Reused across frames; the overlay only runs on the UI thread.
+            static std::vector<float> s_history;
+            profiler.history(FrameProfiler::kFrameStage, s_history);
+            const auto frame = profiler.stats(FrameProfiler::kFrameStage);
+#           ifdef IMGUIX_ENABLE_IMPLOT
+            if (cfg.use_implot) {
+                if (ImPlot::BeginPlot("##frame", ImVec2(-1.0f, cfg.graph_height),
+                        ImPlotFlags_NoTitle | ImPlotFlags_NoMenus | ImPlotFlags_NoLegend)) {
+                    ImPlot::SetupAxes(nullptr, "ms", ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+                    ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, static_cast<double>(FrameProfiler::kHistory), ImGuiCond_Always);
+                    ImPlot::PlotLine("frame", s_history.data(), static_cast<int>(s_history.size()));
+                    if (cfg.budget_ms > 0.0f) {
+                        const double budget = cfg.budget_ms;
+                        ImPlot::PlotInfLines("budget", &budget, 1, ImPlotInfLinesFlags_Horizontal);
+                    }
+                    ImPlot::EndPlot();
+                }
+            } else
+#           endif
+            {
+                char overlay[64];
+                std::snprintf(overlay, sizeof(overlay), "p95 %.2f ms", frame.p95_ms);
+                ImGui::PlotLines("##frame", s_history.data(), static_cast<int>(s_history.size()),
+                                 0, overlay, 0.0f, frame.max_ms * 1.1f,
+                                 ImVec2(-1.0f, cfg.graph_height));
+            }
+        }
+
+        if (cfg.show_table && ImGui::BeginTable("##stages", 6,
+                ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp)) {
+            ImGui::TableSetupColumn("stage");
+            ImGui::TableSetupColumn("last");
+            ImGui::TableSetupColumn("p50");
+            ImGui::TableSetupColumn("p95");
+            ImGui::TableSetupColumn("p99");
+            ImGui::TableSetupColumn("max");
+            ImGui::TableHeadersRow();
+            for (std::size_t i = 0; i < profiler.stageCount(); ++i) {
+                const auto s = profiler.stats(i);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(s.name);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", s.last_ms);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", s.p50_ms);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", s.p95_ms);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", s.p99_ms);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", s.max_ms);
+            }
+            ImGui::EndTable();
+        }
+
+        ImGui::PopID();
+#       endif
+    }
+
+} // namespace ImGuiX::Widgets
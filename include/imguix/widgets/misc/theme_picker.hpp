@@ -79,7 +79,8 @@ namespace ImGuiX::Widgets {
         if (list.empty()) return false;
 
         auto& opts = ctrl->options();
-        std::string cur_id = opts.getStrOr(IMGUIX_THEME_STORAGE_KEY, list[0].id);
+        // Cached handle: the stored theme is decoded again only after it changes.
+        std::string cur_id = ctrl->themeKey(list[0].id).get();
 
         int cur_index = 0;
         for (int i = 0; i < static_cast<int>(list.size()); ++i) {
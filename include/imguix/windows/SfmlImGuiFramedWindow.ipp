@@ -97,7 +97,7 @@ namespace ImGuiX::Windows {
 
     void ImGuiFramedWindow::tick() {
         setCurrentWindow();
-        auto& res = registry().getResource<DeltaClockSfml>();
+        auto& res = m_delta_clock.get();
         ImGui::SFML::Update(m_window, res.delta());
         if (hasFlag(m_flags, WindowFlags::EnableTransparency)) {
             m_window.clear(sf::Color::Transparent);
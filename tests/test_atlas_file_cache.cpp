@@ -0,0 +1,111 @@
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+#include <imgui.h>
+#include <imguix/core/fonts/AtlasFileCache.hpp>
+
+namespace fs = std::filesystem;
+using namespace ImGuiX::Fonts;
+
+namespace {
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << message << '\n';
+        std::exit(1);
+    }
+}
+
+} // namespace
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_atlas_file_cache_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    const std::uint64_t key = 0x1234abcdull;
+    const fs::path path = AtlasFileCache::pathFor(dir, key);
+
+#if IMGUI_VERSION_NUM >= 19200
+    // Glyphs are baked on demand; the cache must stay a no-op.
+    ImFontAtlas atlas;
+    std::unordered_map<FontRole, ImFont*> fonts;
+    require(!AtlasFileCache::isSupported(), "dynamic atlases reported as cacheable");
+    require(!AtlasFileCache::save(path, key, atlas, fonts), "save wrote a dynamic atlas");
+    require(!fs::exists(path), "save left a file behind");
+    require(!AtlasFileCache::load(path, key, atlas, fonts), "load restored a dynamic atlas");
+    std::cout << "Atlas file cache tests skipped (ImGui 1.92+)\n";
+#else
+    require(AtlasFileCache::isSupported(), "static atlases must be cacheable");
+
+    ImFontAtlas source;
+    ImFont* body = source.AddFontDefault();
+    require(body && source.Build(), "default font did not build");
+    unsigned char* src_pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    source.GetTexDataAsRGBA32(&src_pixels, &width, &height);
+    const std::unordered_map<FontRole, ImFont*> roles{
+        {FontRole::Body, body}, {FontRole::Monospace, body}};
+    require(AtlasFileCache::save(path, key, source, roles), "save failed");
+
+    // A different configuration hash is rejected without touching the atlas.
+    {
+        ImFontAtlas other;
+        std::unordered_map<FontRole, ImFont*> fonts;
+        require(!AtlasFileCache::load(path, key + 1, other, fonts), "foreign key accepted");
+        require(other.Fonts.Size == 0 && fonts.empty(), "rejected load modified the atlas");
+    }
+
+    // Round trip: metrics, glyphs, roles and pixels come back unchanged.
+    {
+        ImFontAtlas restored;
+        std::unordered_map<FontRole, ImFont*> fonts;
+        require(AtlasFileCache::load(path, key, restored, fonts), "load failed");
+        require(restored.Fonts.Size == source.Fonts.Size, "font count differs");
+        require(fonts.size() == 2 && fonts[FontRole::Body] == restored.Fonts[0]
+                && fonts[FontRole::Monospace] == restored.Fonts[0], "roles not restored");
+
+        const ImFont* a = source.Fonts[0];
+        const ImFont* b = restored.Fonts[0];
+        require(a->FontSize == b->FontSize && a->Ascent == b->Ascent && a->Descent == b->Descent,
+                "font metrics differ");
+        require(a->Glyphs.Size == b->Glyphs.Size && a->Glyphs.Size > 0, "glyph count differs");
+        for (int i = 0; i < a->Glyphs.Size; ++i) {
+            const ImFontGlyph& ga = a->Glyphs[i];
+            const ImFontGlyph& gb = b->Glyphs[i];
+            require(ga.Codepoint == gb.Codepoint && ga.Visible == gb.Visible
+                    && ga.AdvanceX == gb.AdvanceX
+                    && ga.X0 == gb.X0 && ga.Y0 == gb.Y0 && ga.X1 == gb.X1 && ga.Y1 == gb.Y1
+                    && ga.U0 == gb.U0 && ga.V0 == gb.V0 && ga.U1 == gb.U1 && ga.V1 == gb.V1,
+                    "glyph differs");
+        }
+        require(restored.TexUvWhitePixel.x == source.TexUvWhitePixel.x
+                && restored.TexUvWhitePixel.y == source.TexUvWhitePixel.y, "white pixel differs");
+
+        unsigned char* pixels = nullptr;
+        int w = 0;
+        int h = 0;
+        restored.GetTexDataAsRGBA32(&pixels, &w, &h);
+        require(w == width && h == height, "texture size differs");
+        require(std::memcmp(pixels, src_pixels, static_cast<std::size_t>(w) * h * 4u) == 0,
+                "texture pixels differ");
+    }
+
+    // A truncated file is rejected.
+    {
+        const auto size = fs::file_size(path);
+        fs::resize_file(path, size - 1);
+        ImFontAtlas broken;
+        std::unordered_map<FontRole, ImFont*> fonts;
+        require(!AtlasFileCache::load(path, key, broken, fonts), "truncated file accepted");
+    }
+    std::cout << "Atlas file cache tests passed\n";
+#endif
+
+    fs::remove_all(dir, ec);
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <imguix/utils/atomic_write.hpp>
+#include <imguix/utils/fnv1a.hpp>
+
+namespace fs = std::filesystem;
+using namespace ImGuiX::Utils;
+
+static std::string readFile(const fs::path& path) {
+    std::ifstream f(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+int main() {
+    // Reference values of 64-bit FNV-1a.
+    {
+        Fnv1a empty;
+        Fnv1a a;
+        a.add("a", 1);
+        if (empty.value() != 0xcbf29ce484222325ull || a.value() != 0xaf63dc4c8601ec8cull) {
+            std::cerr << "FNV-1a reference values mismatch\n";
+            return 1;
+        }
+    }
+
+    const fs::path dir = fs::temp_directory_path() / "imguix_atomic_write_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    const fs::path file = dir / "nested" / "data.bin";
+
+    const std::string first = "first";
+    if (!writeFileAtomic(file, first.data(), first.size()) || readFile(file) != first) {
+        std::cerr << "write into a missing directory failed\n";
+        return 1;
+    }
+
+    // Concurrent writers of one path: every write succeeds, one of them wins whole.
+    std::vector<std::thread> writers;
+    std::vector<int> ok(8, 0);
+    for (int t = 0; t < 8; ++t) {
+        writers.emplace_back([&, t] {
+            const std::string text(4096, static_cast<char>('a' + t));
+            for (int i = 0; i < 20; ++i) ok[t] += writeFileAtomic(file, text.data(), text.size());
+        });
+    }
+    for (auto& th : writers) th.join();
+    const std::string last = readFile(file);
+    for (int t = 0; t < 8; ++t) {
+        if (ok[t] != 20) {
+            std::cerr << "concurrent write failed\n";
+            return 1;
+        }
+    }
+    if (last.size() != 4096 || last.find_first_not_of(last[0]) != std::string::npos) {
+        std::cerr << "concurrent writes mixed their contents\n";
+        return 1;
+    }
+    for (const auto& entry : fs::directory_iterator(file.parent_path())) {
+        if (entry.path() != file) {
+            std::cerr << "temporary file left behind\n";
+            return 1;
+        }
+    }
+
+    // A parent that is a file cannot be written into.
+    if (writeFileAtomic(file / "child.bin", first.data(), first.size())) {
+        std::cerr << "write below a file reported success\n";
+        return 1;
+    }
+
+    fs::remove_all(dir, ec);
+    std::cout << "Atomic write tests passed\n";
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "imguix/core/pubsub.hpp"
+
+using namespace ImGuiX::Pubsub;
+
+struct PriceEvent : Event {
+    int symbol{};
+    int price{};
+    PriceEvent(int s, int p) : symbol(s), price(p) {}
+    std::type_index type() const override { return typeid(PriceEvent); }
+    IMGUIX_EVENT_TYPE_ID(PriceEvent)
+    const char* name() const override { return "PriceEvent"; }
+    IMGUIX_CLONEABLE_EVENT(PriceEvent)
+};
+
+static bool checkDropNewest() {
+    EventBus bus;
+    AsyncQueueOptions opt;
+    opt.capacity = 4;
+    opt.overflow = AsyncOverflowPolicy::DropNewest;
+    bus.configureAsyncQueue(opt);
+
+    std::vector<int> seen;
+    EventMediator med(bus);
+    med.subscribe<PriceEvent>([&](const PriceEvent& e) { seen.push_back(e.price); });
+
+    for (int i = 0; i < 6; ++i) bus.notifyAsync(std::make_unique<PriceEvent>(0, i));
+    bus.process();
+
+    const auto stats = bus.asyncQueueStats();
+    return seen == std::vector<int>{0, 1, 2, 3} && stats.dropped == 2 && stats.high_water == 4;
+}
+
+static bool checkDropOldest() {
+    EventBus bus;
+    AsyncQueueOptions opt;
+    opt.capacity = 4;
+    opt.overflow = AsyncOverflowPolicy::DropOldest;
+    opt.batch_size = 3;
+    bus.configureAsyncQueue(opt);
+
+    std::vector<int> seen;
+    EventMediator med(bus);
+    med.subscribe<PriceEvent>([&](const PriceEvent& e) { seen.push_back(e.price); });
+
+    for (int i = 0; i < 6; ++i) bus.notifyAsync(std::make_unique<PriceEvent>(0, i));
+    bus.process();
+
+    return seen == std::vector<int>{2, 3, 4, 5} && bus.asyncQueueStats().dropped == 2;
+}
+
+static bool checkCoalesce() {
+    EventBus bus;
+    AsyncQueueOptions opt;
+    opt.capacity = 2;
+    opt.overflow = AsyncOverflowPolicy::CoalesceByKey;
+    opt.coalesce_key = [](const Event& e) {
+        return static_cast<std::uint64_t>(e.as<PriceEvent>()->symbol);
+    };
+    bus.configureAsyncQueue(opt);
+
+    std::vector<int> seen;
+    EventMediator med(bus);
+    med.subscribe<PriceEvent>([&](const PriceEvent& e) { seen.push_back(e.symbol * 100 + e.price); });
+
+    bus.notifyAsync(std::make_unique<PriceEvent>(1, 1));
+    bus.notifyAsync(std::make_unique<PriceEvent>(2, 1));
+    bus.notifyAsync(std::make_unique<PriceEvent>(1, 2)); // overflow, key 1
+    bus.notifyAsync(std::make_unique<PriceEvent>(2, 2)); // overflow, key 2
+    bus.notifyAsync(std::make_unique<PriceEvent>(1, 3)); // replaces key 1
+    bus.process();
+
+    return seen == std::vector<int>{101, 201, 103, 202} && bus.asyncQueueStats().coalesced == 1;
+}
+
+static bool checkBlockingProducers() {
+    EventBus bus;
+    AsyncQueueOptions opt;
+    opt.capacity = 16;
+    opt.overflow = AsyncOverflowPolicy::Block;
+    opt.batch_size = 8;
+    bus.configureAsyncQueue(opt);
+
+    std::atomic<int> received{0};
+    EventMediator med(bus);
+    med.subscribe<PriceEvent>([&](const PriceEvent&) { received.fetch_add(1); });
+
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 5000;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&bus, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                bus.notifyAsync(std::make_unique<PriceEvent>(p, i));
+            }
+        });
+    }
+
+    while (received.load() < kProducers * kPerProducer) {
+        bus.process();
+        std::this_thread::yield();
+    }
+    for (auto& t : producers) t.join();
+    bus.process();
+
+    const auto stats = bus.asyncQueueStats();
+    return received.load() == kProducers * kPerProducer && stats.dropped == 0 && stats.high_water <= 16;
+}
+
+int main() {
+    if (!checkDropNewest()) { std::cerr << "drop-newest policy failed\n"; return 1; }
+    if (!checkDropOldest()) { std::cerr << "drop-oldest policy failed\n"; return 1; }
+    if (!checkCoalesce()) { std::cerr << "coalesce policy failed\n"; return 1; }
+    if (!checkBlockingProducers()) { std::cerr << "blocking producers lost events\n"; return 1; }
+
+    std::cout << "Async ring buffer tests passed\n";
+    return 0;
+}
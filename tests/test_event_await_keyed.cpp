@@ -0,0 +1,105 @@
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#define private public
+#include "imguix/core/pubsub.hpp"
+#undef private
+
+using namespace ImGuiX::Pubsub;
+using namespace std::chrono_literals;
+
+struct ReplyEvent : Event {
+    std::uint64_t request_id{};
+    int value{};
+    ReplyEvent(std::uint64_t id, int v) : request_id(id), value(v) {}
+    std::type_index type() const override { return typeid(ReplyEvent); }
+    IMGUIX_EVENT_TYPE_ID(ReplyEvent)
+    const char* name() const override { return "ReplyEvent"; }
+    IMGUIX_CLONEABLE_EVENT(ReplyEvent)
+};
+
+int main() {
+    EventBus bus;
+    EventMediator med(bus);
+
+    bool threw = false;
+    try {
+        med.awaitOnceByKey<ReplyEvent>(1, [](const ReplyEvent&) {});
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    if (!threw) { std::cerr << "missing key extractor not reported\n"; return 1; }
+
+    med.setAwaitKey<ReplyEvent>([](const ReplyEvent& e) { return e.request_id; });
+
+    // Many in-flight requests, answered in reverse order.
+    constexpr int kRequests = 20000;
+    std::vector<int> results(kRequests, -1);
+    for (int i = 0; i < kRequests; ++i) {
+        med.awaitOnceByKey<ReplyEvent>(static_cast<AwaitKey>(i), [&results, i](const ReplyEvent& e) {
+            results[i] = e.value;
+        });
+    }
+    for (int i = kRequests - 1; i >= 0; --i) {
+        bus.notifyAsync(std::make_unique<ReplyEvent>(static_cast<std::uint64_t>(i), i * 2));
+    }
+    // A duplicate reply must not reach an already completed awaiter.
+    bus.notifyAsync(std::make_unique<ReplyEvent>(7, -100));
+    bus.process();
+
+    for (int i = 0; i < kRequests; ++i) {
+        if (results[i] != i * 2) {
+            std::cerr << "request " << i << " got " << results[i] << "\n";
+            return 1;
+        }
+    }
+
+    // Multi-shot keyed awaiter, cancelled manually.
+    int hits = 0;
+    auto each = med.awaitEachByKey<ReplyEvent>(42, [&](const ReplyEvent&) { ++hits; });
+    bus.notify(ReplyEvent{42, 1});
+    bus.notify(ReplyEvent{43, 1});
+    bus.notify(ReplyEvent{42, 2});
+    each->cancel();
+    bus.notify(ReplyEvent{42, 3});
+    if (hits != 2 || each->isActive()) { std::cerr << "keyed awaitEach mismatch\n"; return 1; }
+
+    // Timeout for a reply that never comes.
+    int timeouts = 0;
+    bool late = false;
+    med.awaitOnceByKey<ReplyEvent>(99, [&](const ReplyEvent&) { late = true; }, 5ms, [&] { ++timeouts; });
+    const auto stop = std::chrono::steady_clock::now() + 200ms;
+    while (timeouts == 0 && std::chrono::steady_clock::now() < stop) bus.process();
+    bus.notify(ReplyEvent{99, 1});
+    if (timeouts != 1 || late) { std::cerr << "keyed timeout mismatch\n"; return 1; }
+
+    // cancel() removes its own entry even next to entries of awaiters that
+    // expired but have not removed themselves yet.
+    {
+        auto index = AwaiterIndex<ReplyEvent>::create(
+            bus, [](const ReplyEvent& e) { return e.request_id; });
+        using Awaiter = EventAwaiter<ReplyEvent>;
+        int calls = 0;
+        auto live = Awaiter::createKeyed(bus, index, 5, {}, [&](const ReplyEvent&) { ++calls; });
+        const Awaiter* dying = reinterpret_cast<const Awaiter*>(&calls);
+        index->add(5, dying, std::weak_ptr<Awaiter>());
+        index->add(6, dying, std::weak_ptr<Awaiter>());
+        live->cancel();
+        bool still_indexed = false;
+        for (const auto& kv : index->m_awaiters) still_indexed |= kv.second.raw == live.get();
+        bus.notify(ReplyEvent{5, 1});
+        if (still_indexed || calls != 0 || index->size() != 1) {
+            std::cerr << "cancelled keyed awaiter left in the index\n";
+            return 1;
+        }
+    }
+
+    std::cout << "Keyed awaiter tests passed\n";
+    return 0;
+}
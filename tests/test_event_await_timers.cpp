@@ -0,0 +1,86 @@
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "imguix/core/pubsub.hpp"
+
+using namespace ImGuiX::Pubsub;
+using namespace std::chrono_literals;
+
+struct PingEvent : Event {
+    std::type_index type() const override { return typeid(PingEvent); }
+    const char* name() const override { return "PingEvent"; }
+    IMGUIX_CLONEABLE_EVENT(PingEvent)
+};
+
+/// Counts how often the bus polls it.
+struct ProbeAwaiter : IAwaiterEx {
+    std::chrono::steady_clock::time_point when;
+    int polls{0};
+    bool active{true};
+    explicit ProbeAwaiter(std::chrono::steady_clock::time_point t) : when(t) {}
+    void cancel() noexcept override { active = false; }
+    bool isActive() const noexcept override { return active; }
+    void pollTimeout() noexcept override { ++polls; }
+    std::chrono::steady_clock::time_point pollDeadline() const noexcept override { return when; }
+};
+
+int main() {
+    using clock = std::chrono::steady_clock;
+    EventBus bus;
+
+    auto never = std::make_shared<ProbeAwaiter>(clock::time_point::max());
+    auto every = std::make_shared<ProbeAwaiter>(clock::time_point::min());
+    auto later = std::make_shared<ProbeAwaiter>(clock::now() + 20ms);
+    bus.registerAwaiter(never);
+    bus.registerAwaiter(every);
+    bus.registerAwaiter(later);
+
+    for (int i = 0; i < 5; ++i) bus.process();
+    if (never->polls != 0 || every->polls != 5 || later->polls != 0) {
+        std::cerr << "awaiters polled before their deadline\n";
+        return 1;
+    }
+
+    std::this_thread::sleep_for(25ms);
+    for (int i = 0; i < 5; ++i) bus.process();
+    if (later->polls != 1 || never->polls != 0) {
+        std::cerr << "expired awaiter must be polled exactly once\n";
+        return 1;
+    }
+
+    // Timeouts fire in deadline order regardless of registration order,
+    // and awaiters without timeout or token stay untouched.
+    EventMediator med(bus);
+    std::vector<int> fired;
+    auto a = med.awaitEach<PingEvent>([](const PingEvent&) {}, 30ms, [&] { fired.push_back(3); });
+    auto b = med.awaitEach<PingEvent>([](const PingEvent&) {}, 5ms, [&] { fired.push_back(1); });
+    auto c = med.awaitEach<PingEvent>([](const PingEvent&) {}, 15ms, [&] { fired.push_back(2); });
+    auto idle = med.awaitEach<PingEvent>([](const PingEvent&) {});
+
+    const auto stop = clock::now() + 200ms;
+    while (fired.size() < 3 && clock::now() < stop) {
+        std::this_thread::sleep_for(1ms);
+        bus.process();
+    }
+    if (fired != std::vector<int>{1, 2, 3}) {
+        std::cerr << "timeouts fired out of order\n";
+        return 1;
+    }
+    if (a->isActive() || b->isActive() || c->isActive() || !idle->isActive()) {
+        std::cerr << "timeout state mismatch\n";
+        return 1;
+    }
+
+    // Many short-lived awaiters with long deadlines: finished ones are pruned
+    // from the heap instead of piling up until their deadline.
+    for (int i = 0; i < 10000; ++i) {
+        auto aw = med.awaitEach<PingEvent>([](const PingEvent&) {}, std::chrono::milliseconds(1h));
+        aw->cancel();
+    }
+    bus.process();
+
+    std::cout << "Awaiter timer tests passed\n";
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <vector>
+
+#include "imguix/core/pubsub.hpp"
+
+using namespace ImGuiX::Pubsub;
+
+struct QuoteEvent : Event {
+    int symbol{};
+    int price{};
+    QuoteEvent(int s, int p) : symbol(s), price(p) {}
+    std::type_index type() const override { return typeid(QuoteEvent); }
+    IMGUIX_EVENT_TYPE_ID(QuoteEvent)
+    const char* name() const override { return "QuoteEvent"; }
+    IMGUIX_CLONEABLE_EVENT(QuoteEvent)
+};
+
+struct SnapshotEvent : Event {
+    int version{};
+    explicit SnapshotEvent(int v) : version(v) {}
+    std::type_index type() const override { return typeid(SnapshotEvent); }
+    const char* name() const override { return "SnapshotEvent"; }
+    IMGUIX_CLONEABLE_EVENT(SnapshotEvent)
+};
+
+int main() {
+    EventBus bus;
+    EventMediator med(bus);
+
+    std::vector<int> quotes;
+    std::vector<int> snapshots;
+    med.subscribe<QuoteEvent>([&](const QuoteEvent& e) { quotes.push_back(e.symbol * 100 + e.price); });
+    med.subscribe<SnapshotEvent>([&](const SnapshotEvent& e) { snapshots.push_back(e.version); });
+
+    bus.setLatestWins<SnapshotEvent>();
+    bus.setLatestWins<QuoteEvent>([](const QuoteEvent& e) {
+        return static_cast<std::uint64_t>(e.symbol);
+    });
+
+    for (int i = 1; i <= 5; ++i) {
+        bus.notifyAsync(std::make_unique<SnapshotEvent>(i));
+        bus.notifyAsync(std::make_unique<QuoteEvent>(1, i));
+        bus.notifyAsync(std::make_unique<QuoteEvent>(2, i * 2));
+    }
+    bus.process();
+
+    if (snapshots != std::vector<int>{5}) {
+        std::cerr << "type-level conflation delivered stale snapshots\n";
+        return 1;
+    }
+    if (quotes != std::vector<int>{105, 210}) {
+        std::cerr << "keyed conflation delivered wrong quotes\n";
+        return 1;
+    }
+    if (bus.asyncQueueStats().conflated != 12) {
+        std::cerr << "conflated counter mismatch\n";
+        return 1;
+    }
+
+    // Synchronous notify is never conflated.
+    snapshots.clear();
+    bus.notify(SnapshotEvent{6});
+    bus.notify(SnapshotEvent{7});
+    if (snapshots != std::vector<int>{6, 7}) {
+        std::cerr << "notify() must bypass conflation\n";
+        return 1;
+    }
+
+    // Back to regular queuing.
+    snapshots.clear();
+    bus.clearLatestWins<SnapshotEvent>();
+    bus.notifyAsync(std::make_unique<SnapshotEvent>(8));
+    bus.notifyAsync(std::make_unique<SnapshotEvent>(9));
+    bus.process();
+    if (snapshots != std::vector<int>{8, 9}) {
+        std::cerr << "clearLatestWins did not restore queuing\n";
+        return 1;
+    }
+
+    std::cout << "Event conflation tests passed\n";
+    return 0;
+}
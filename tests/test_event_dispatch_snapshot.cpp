@@ -0,0 +1,73 @@
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+#include "imguix/core/pubsub.hpp"
+
+using namespace ImGuiX::Pubsub;
+
+struct TickEvent : Event {
+    int value{};
+    explicit TickEvent(int v) : value(v) {}
+    std::type_index type() const override { return typeid(TickEvent); }
+    const char* name() const override { return "TickEvent"; }
+    std::unique_ptr<Event> clone() const override { return std::make_unique<TickEvent>(*this); }
+};
+
+int main() {
+    EventBus bus;
+    EventMediator first(bus);
+    EventMediator second(bus);
+
+    // Unsubscribing from inside a callback must not break the running dispatch.
+    int first_hits = 0;
+    int second_hits = 0;
+    first.subscribe<TickEvent>([&](const TickEvent&) {
+        ++first_hits;
+        first.unsubscribe<TickEvent>();
+        second.unsubscribe<TickEvent>();
+    });
+    second.subscribe<TickEvent>([&](const TickEvent&) { ++second_hits; });
+
+    bus.notify(TickEvent{1});
+    if (first_hits != 1 || second_hits != 1) {
+        std::cerr << "snapshot dispatch lost a subscriber\n";
+        return 1;
+    }
+
+    bus.notify(TickEvent{2});
+    if (first_hits != 1 || second_hits != 1) {
+        std::cerr << "unsubscribed callbacks still notified\n";
+        return 1;
+    }
+
+    // Subscriptions changing on another thread while dispatching.
+    std::atomic<int> hits{0};
+    EventMediator stable(bus);
+    stable.subscribe<TickEvent>([&](const TickEvent&) { hits.fetch_add(1); });
+
+    std::atomic<bool> stop{false};
+    std::thread churn([&] {
+        EventMediator volatile_med(bus);
+        while (!stop.load()) {
+            volatile_med.subscribe<TickEvent>([](const TickEvent&) {});
+            volatile_med.unsubscribe<TickEvent>();
+        }
+    });
+
+    constexpr int kEvents = 20000;
+    for (int i = 0; i < kEvents; ++i) {
+        bus.notify(TickEvent{i});
+    }
+    stop = true;
+    churn.join();
+    bus.process();
+
+    if (hits.load() != kEvents) {
+        std::cerr << "stable subscriber missed events: " << hits.load() << "\n";
+        return 1;
+    }
+
+    std::cout << "Dispatch snapshot tests passed\n";
+    return 0;
+}
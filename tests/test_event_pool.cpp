@@ -0,0 +1,127 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "imguix/core/pubsub.hpp"
+
+using namespace ImGuiX::Pubsub;
+
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Count global heap allocations to verify the steady state is heap-free.
+static std::atomic<std::size_t> g_heap_allocs{0};
+
+void* operator new(std::size_t size) {
+    g_heap_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+struct TickEvent : Event {
+    int seq{};
+    std::string tag;
+    TickEvent(int s, std::string t) : seq(s), tag(std::move(t)) {}
+    std::type_index type() const override { return typeid(TickEvent); }
+    IMGUIX_EVENT_TYPE_ID(TickEvent)
+    const char* name() const override { return "TickEvent"; }
+    IMGUIX_CLONEABLE_EVENT(TickEvent)
+};
+
+struct alignas(64) WideEvent : Event {
+    double values[16]{};
+    std::type_index type() const override { return typeid(WideEvent); }
+    const char* name() const override { return "WideEvent"; }
+    IMGUIX_CLONEABLE_EVENT(WideEvent)
+};
+
+// Owns events from a thread_local constructed before the pool cache, so they
+// are freed (and another one allocated) after the cache is gone.
+struct LateOwner {
+    std::vector<std::unique_ptr<Event>> events;
+    ~LateOwner() {
+        events.clear();
+        auto late = std::make_unique<TickEvent>(0, "late");
+        late.reset();
+    }
+};
+
+static void runLateOwnerThread() {
+    std::thread([] {
+        thread_local LateOwner owner;
+        for (int i = 0; i < 64; ++i) {
+            owner.events.push_back(std::make_unique<TickEvent>(i, "owned"));
+        }
+    }).join();
+}
+
+int main() {
+    // Blocks freed after thread teardown must return to the shared lists.
+    for (int i = 0; i < 4; ++i) runLateOwnerThread();
+    const auto late_slabs = EventPool::stats().slab_count;
+    for (int i = 0; i < 50; ++i) runLateOwnerThread();
+    if (EventPool::stats().slab_count != late_slabs) {
+        std::cerr << "events freed after thread teardown were lost\n";
+        return 1;
+    }
+
+    EventBus bus;
+    EventMediator med(bus);
+
+    long long sum = 0;
+    med.subscribe<TickEvent>([&](const TickEvent& e) { sum += e.seq; });
+    med.registerCachedEvent<TickEvent>("last");
+
+    auto runFrame = [&](int base) {
+        for (int i = 0; i < 100; ++i) {
+            med.emplaceAsync<TickEvent>(base + i, "tick");
+        }
+        bus.process();
+    };
+
+    // Warm up pools, queue storage and the cached slot.
+    for (int frame = 0; frame < 10; ++frame) runFrame(frame * 100);
+
+    const auto slabs_before = EventPool::stats().slab_count;
+    const std::size_t allocs_before = g_heap_allocs.load();
+    for (int frame = 0; frame < 1000; ++frame) runFrame(frame * 100);
+    const std::size_t allocs = g_heap_allocs.load() - allocs_before;
+
+    if (EventPool::stats().slab_count != slabs_before) {
+        std::cerr << "event pool kept growing in steady state\n";
+        return 1;
+    }
+    if (allocs != 0) {
+        std::cerr << "steady-state event traffic hit the heap " << allocs << " times\n";
+        return 1;
+    }
+
+    auto cached = med.getCachedEvent<TickEvent>("last");
+    if (!cached || cached->seq != 999 * 100 + 99 || cached->tag != "tick") {
+        std::cerr << "cached slot not updated in place\n";
+        return 1;
+    }
+
+    // copyTo refuses mismatched types; over-aligned events bypass the pool.
+    TickEvent tick(1, "a");
+    auto wide = std::make_unique<WideEvent>();
+    if (tick.copyTo(*wide)) {
+        std::cerr << "copyTo accepted a different event type\n";
+        return 1;
+    }
+    if (reinterpret_cast<std::uintptr_t>(wide.get()) % alignof(WideEvent) != 0) {
+        std::cerr << "over-aligned event misaligned\n";
+        return 1;
+    }
+
+    std::cout << "Event pool tests passed (" << sum << ")\n";
+    return 0;
+}
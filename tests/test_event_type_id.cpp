@@ -0,0 +1,104 @@
+#include <iostream>
+#include <thread>
+#include <utility>
+
+#include "imguix/core/pubsub.hpp"
+
+using namespace ImGuiX::Pubsub;
+
+// Event relying on the default typeId() (resolved through type()).
+struct LegacyEvent : Event {
+    std::type_index type() const override { return typeid(LegacyEvent); }
+    const char* name() const override { return "LegacyEvent"; }
+    std::unique_ptr<Event> clone() const override { return std::make_unique<LegacyEvent>(*this); }
+};
+
+// Event with a precomputed dense ID.
+struct FastEvent : Event {
+    int value{};
+    explicit FastEvent(int v) : value(v) {}
+    std::type_index type() const override { return typeid(FastEvent); }
+    IMGUIX_EVENT_TYPE_ID(FastEvent)
+    const char* name() const override { return "FastEvent"; }
+    IMGUIX_CLONEABLE_EVENT(FastEvent)
+};
+
+// Many legacy types overflow the per-thread ID cache.
+template <int N>
+struct ManyEvent : Event {
+    std::type_index type() const override { return typeid(ManyEvent<N>); }
+    const char* name() const override { return "ManyEvent"; }
+    std::unique_ptr<Event> clone() const override { return std::make_unique<ManyEvent<N>>(*this); }
+};
+
+template <int... N>
+bool manyIdsMatch(std::integer_sequence<int, N...>) {
+    bool ok = true;
+    for (int pass = 0; pass < 2; ++pass) {
+        ((ok = ok && ManyEvent<N>{}.typeId() == eventTypeId<ManyEvent<N>>()), ...);
+    }
+    return ok;
+}
+
+int main() {
+    const EventTypeId legacy_id = eventTypeId<LegacyEvent>();
+    const EventTypeId fast_id = eventTypeId<FastEvent>();
+    if (legacy_id == fast_id) {
+        std::cerr << "event types share an ID\n";
+        return 1;
+    }
+    if (legacy_id != eventTypeId<LegacyEvent>() || fast_id != eventTypeId<FastEvent>()) {
+        std::cerr << "event type ID is not stable\n";
+        return 1;
+    }
+
+    LegacyEvent legacy;
+    FastEvent fast(3);
+    if (legacy.typeId() != legacy_id || fast.typeId() != fast_id) {
+        std::cerr << "runtime ID differs from compile-time ID\n";
+        return 1;
+    }
+    if (!legacy.is<LegacyEvent>() || legacy.is<FastEvent>() || !fast.is<FastEvent>()) {
+        std::cerr << "is<T>() mismatch\n";
+        return 1;
+    }
+    if (!fast.as<FastEvent>() || fast.as<FastEvent>()->value != 3) {
+        std::cerr << "as<T>() mismatch\n";
+        return 1;
+    }
+
+    if (!manyIdsMatch(std::make_integer_sequence<int, 48>{})) {
+        std::cerr << "cached default typeId() mismatch after eviction\n";
+        return 1;
+    }
+    bool thread_ok = false;
+    std::thread([&] { thread_ok = LegacyEvent{}.typeId() == legacy_id; }).join();
+    if (!thread_ok) {
+        std::cerr << "default typeId() differs between threads\n";
+        return 1;
+    }
+    if (detail::dispatchTypeId(legacy) != legacy_id || detail::dispatchTypeId(fast) != fast_id) {
+        std::cerr << "dispatchTypeId() mismatch\n";
+        return 1;
+    }
+
+    EventBus bus;
+    EventMediator med(bus);
+    int legacy_hits = 0;
+    int fast_hits = 0;
+    med.subscribe<LegacyEvent>([&](const LegacyEvent&) { ++legacy_hits; });
+    med.subscribe<FastEvent>([&](const FastEvent& e) { fast_hits += e.value; });
+
+    bus.notify(legacy);
+    bus.notify(fast);
+    bus.notifyAsync(std::make_unique<FastEvent>(4));
+    bus.process();
+
+    if (legacy_hits != 1 || fast_hits != 7) {
+        std::cerr << "dispatch by type ID failed\n";
+        return 1;
+    }
+
+    std::cout << "Event type ID tests passed\n";
+    return 0;
+}
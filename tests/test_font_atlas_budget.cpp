@@ -0,0 +1,110 @@
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include <imgui.h>
+
+#define private public
+#include <imguix/core/fonts/FontManager.hpp>
+#undef private
+
+using namespace ImGuiX::Fonts;
+
+namespace {
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << message << '\n';
+        std::exit(1);
+    }
+}
+
+void testTrimState() {
+    FontManager a;
+    FontManager b;
+    AtlasTrimState trim;
+    require(trim.shouldCheck(&a), "first owner must become the checker");
+    require(!trim.shouldCheck(&b), "second owner must not check a shared atlas");
+
+    trim.trimmed();
+    for (int i = 0; i < IMGUIX_FONTS_DYNAMIC_TRIM_INTERVAL; ++i) {
+        require(!trim.shouldCheck(&a) && !trim.shouldCheck(&b), "checked during the cooldown");
+    }
+    require(trim.shouldCheck(&a), "cooldown counted frames of other owners");
+
+    trim.release(&a);
+    require(trim.shouldCheck(&b), "released checks were not handed over");
+    require(!trim.shouldCheck(&a), "previous checker still checks");
+}
+
+#if IMGUI_VERSION_NUM >= 19200
+// One frame as WindowManager::syncFontsAll() runs it: every owner asks once.
+int overBudgetOwners(FontManager& a, FontManager& b) {
+    int n = 0;
+    for (FontManager* fm : {&a, &b}) {
+        if (fm->isAtlasOverBudget()) {
+            ++n;
+            fm->trimState().trimmed(); // bookkeeping of trimAtlas() without CompactCache()
+        }
+    }
+    return n;
+}
+
+void testSharedCooldown() {
+    auto cache = std::make_shared<FontAtlasCache>();
+    auto shared = cache->acquire(1);
+    ImTextureData tex;
+    tex.Width = 2048;
+    tex.Height = 2048;
+    tex.BytesPerPixel = 4;
+    ImTextureData* const original = shared->atlas->TexData;
+    shared->atlas->TexData = &tex;
+
+    FontManager a;
+    FontManager b;
+    for (FontManager* fm : {&a, &b}) {
+        fm->m_shared = shared;
+        fm->m_atlas = shared->atlas.get();
+        fm->setAtlasBudget(1024); // dynamic glyphs stay off: 1.92 atlases grow either way
+    }
+
+    // Two owners, one atlas: trimmed once, then once per interval.
+    require(overBudgetOwners(a, b) == 1, "shared atlas trimmed by every owner");
+    int trims = 0;
+    for (int frame = 0; frame < IMGUIX_FONTS_DYNAMIC_TRIM_INTERVAL; ++frame) {
+        trims += overBudgetOwners(a, b);
+    }
+    require(trims == 0, "cooldown ran out early with several owners");
+    require(overBudgetOwners(a, b) == 1, "budget not checked after the cooldown");
+
+    // Under budget: nothing to trim.
+    tex.Width = tex.Height = 8;
+    for (int frame = 0; frame <= IMGUIX_FONTS_DYNAMIC_TRIM_INTERVAL + 1; ++frame) {
+        require(overBudgetOwners(a, b) == 0, "atlas under budget reported as over");
+    }
+
+    // Budget 0 disables trimming.
+    tex.Width = tex.Height = 2048;
+    a.setAtlasBudget(0);
+    b.setAtlasBudget(0);
+    for (int frame = 0; frame <= IMGUIX_FONTS_DYNAMIC_TRIM_INTERVAL + 1; ++frame) {
+        require(overBudgetOwners(a, b) == 0, "budget 0 still trims");
+    }
+
+    shared->atlas->TexData = original;
+    a.m_atlas = b.m_atlas = nullptr;
+}
+#endif
+
+} // namespace
+
+int main() {
+    ImGui::CreateContext();
+    testTrimState();
+#if IMGUI_VERSION_NUM >= 19200
+    testSharedCooldown();
+#endif
+    ImGui::DestroyContext();
+    std::cout << "Font atlas budget tests passed\n";
+    return 0;
+}
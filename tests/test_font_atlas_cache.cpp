@@ -0,0 +1,111 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#include <imgui.h>
+
+#define private public
+#include <imguix/core/fonts/FontManager.hpp>
+#undef private
+
+namespace fs = std::filesystem;
+using namespace ImGuiX::Fonts;
+
+namespace {
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << message << '\n';
+        std::exit(1);
+    }
+}
+
+void setupManual(FontManager& fm, const std::string& body_path) {
+    fm.beginManual();
+    FontFile ff;
+    ff.path = body_path;
+    ff.size_px = 16.0f;
+    fm.addFontBody(ff);
+}
+
+void testAcquire() {
+    FontAtlasCache cache;
+    auto a = cache.acquire(1);
+    auto b = cache.acquire(1);
+    auto c = cache.acquire(2);
+    require(a && a == b, "same key must return the same atlas");
+    require(a != c && c->key == 2, "different keys must return different atlases");
+    require(a->atlas && a->generation == 0, "new atlas must be empty and never built");
+    require(cache.size() == 2, "cache must count owned atlases");
+
+    a->generation = 5;
+    b.reset();
+    require(cache.acquire(1)->generation == 5, "atlas must live while an owner holds it");
+
+    // Last owner gone: the slot expires and the next acquire starts fresh.
+    a.reset();
+    require(cache.size() == 1, "released atlas still counted");
+    auto again = cache.acquire(1);
+    require(again->generation == 0, "expired atlas was reused");
+    c.reset();
+    again.reset();
+    require(cache.size() == 0, "cache kept atlases without owners");
+}
+
+void testConfigKey(const fs::path& dir) {
+    FontManager a;
+    FontManager b;
+    setupManual(a, "Body.ttf");
+    setupManual(b, "Body.ttf");
+    require(a.configKey() == b.configKey(), "identical configurations must share a key");
+
+    b.setMarkdownSizes(16.0f, 32.0f, 24.0f, 20.0f);
+    a.setMarkdownSizes(16.0f, 30.0f, 24.0f, 20.0f);
+    require(a.configKey() != b.configKey(), "Markdown sizes must change the key");
+    a.setMarkdownSizes(16.0f, 32.0f, 24.0f, 20.0f);
+    require(a.configKey() == b.configKey(), "key must depend only on the configuration");
+
+    b.setLocale("ru");
+    require(a.configKey() != b.configKey(), "locale must change the key");
+    a.setLocale("ru");
+
+    b.setRanges(std::vector<ImWchar>{0x20, 0x7F, 0});
+    require(a.configKey() != b.configKey(), "glyph ranges must change the key");
+    b.clearRanges();
+    require(a.configKey() == b.configKey(), "cleared ranges must restore the key");
+
+    FontManager other;
+    setupManual(other, "Other.ttf");
+    other.setMarkdownSizes(16.0f, 32.0f, 24.0f, 20.0f);
+    other.setLocale("ru");
+    require(a.configKey() != other.configKey(), "font files must change the key");
+
+    // The disk key also covers the font file contents (size and mtime).
+    const fs::path font = dir / "Body.ttf";
+    { std::ofstream(font, std::ios::binary) << "abc"; }
+    const std::uint64_t disk = a.configKey(&dir);
+    require(disk != a.configKey(), "disk key must include build switches");
+    { std::ofstream(font, std::ios::binary | std::ios::app) << "def"; }
+    require(a.configKey(&dir) != disk, "disk key must change with the font file");
+}
+
+} // namespace
+
+int main() {
+    ImGui::CreateContext();
+
+    const fs::path dir = fs::temp_directory_path() / "imguix_font_atlas_cache_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir, ec);
+
+    testAcquire();
+    testConfigKey(dir);
+
+    fs::remove_all(dir, ec);
+    ImGui::DestroyContext();
+    std::cout << "Font atlas cache tests passed\n";
+    return 0;
+}
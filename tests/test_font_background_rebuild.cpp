@@ -0,0 +1,126 @@
+#include <cstdlib>
+#include <future>
+#include <iostream>
+
+#include <imgui.h>
+
+#define private public
+#include <imguix/core/fonts/FontManager.hpp>
+#undef private
+
+using namespace ImGuiX::Fonts;
+
+namespace {
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << message << '\n';
+        std::exit(1);
+    }
+}
+
+// Stands in for a finished worker, so the swap is tested without a second thread.
+ImFontAtlas* startPending(FontManager& fm) {
+    FontManager::PendingBuild build;
+    build.atlas.reset(IM_NEW(ImFontAtlas)());
+    ImFontAtlas* const atlas = build.atlas.get();
+    build.fonts[FontRole::Body] = atlas->AddFontDefault();
+    build.message = "pending";
+
+    std::promise<FontManager::PendingBuild> promise;
+    fm.m_pending_build = promise.get_future();
+    fm.m_dirty = false;
+    promise.set_value(std::move(build));
+    return atlas;
+}
+
+void setup(FontManager& fm) {
+    fm.setBackgroundRebuild(false); // restarts after applyRebuild() stay synchronous
+    fm.beginManual();
+    require(fm.buildNow().success, "initial build failed");
+}
+
+void testNothingPending() {
+    FontManager fm;
+    setup(fm);
+    ImFontAtlas* const atlas = ImGui::GetIO().Fonts;
+    require(!fm.isRebuildPending() && !fm.isRebuildReady(), "idle manager reports a rebuild");
+    require(fm.applyRebuild().success, "applyRebuild failed without a pending build");
+    require(ImGui::GetIO().Fonts == atlas, "applyRebuild swapped without a pending build");
+    fm.discardRebuild();
+}
+
+void testApply() {
+    FontManager fm;
+    setup(fm);
+    ImFontAtlas* const atlas = startPending(fm);
+    ImFont* const body = atlas->Fonts[0];
+    require(fm.isRebuildPending() && fm.isRebuildReady(), "finished build not ready");
+
+    const BuildResult br = fm.applyRebuild();
+    require(br.success && br.message == "pending", "applyRebuild did not report the build");
+    require(ImGui::GetIO().Fonts == atlas, "atlas not swapped in");
+    require(ImGui::GetIO().FontDefault == body && fm.getFont(FontRole::Body) == body,
+            "fonts of the new atlas not adopted");
+    require(!fm.isRebuildPending() && !fm.m_dirty, "rebuild still pending after the swap");
+}
+
+void testMarkDirtyWhilePending() {
+    FontManager fm;
+    setup(fm);
+    ImFontAtlas* const old_atlas = ImGui::GetIO().Fonts;
+    ImFontAtlas* const new_atlas = startPending(fm);
+
+    // A change during the build neither swaps nor starts a second build.
+    fm.markDirty();
+    const BuildResult br = fm.rebuildIfNeeded();
+    require(br.success && fm.isRebuildPending() && fm.m_dirty, "change during the build lost");
+    require(ImGui::GetIO().Fonts == old_atlas, "atlas swapped before applyRebuild");
+
+    // The swap picks the change up and rebuilds the new atlas right away.
+    require(fm.applyRebuild().message == "pending", "pending build replaced");
+    require(ImGui::GetIO().Fonts == new_atlas, "atlas not swapped in");
+    // The pending atlas had a Body font; the current configuration has none.
+    require(!fm.m_dirty && !fm.isRebuildPending() && fm.m_fonts.empty(),
+            "change during the build not rebuilt");
+}
+
+void testDiscard() {
+    FontManager fm;
+    setup(fm);
+    ImFontAtlas* const atlas = ImGui::GetIO().Fonts;
+    (void)startPending(fm);
+    fm.discardRebuild();
+    require(!fm.isRebuildPending() && ImGui::GetIO().Fonts == atlas, "discarded build swapped in");
+
+    // buildNow() drops a pending build instead of swapping it in later.
+    (void)startPending(fm);
+    require(fm.buildNow().success, "buildNow failed");
+    require(!fm.isRebuildPending() && ImGui::GetIO().Fonts == atlas, "buildNow kept the pending build");
+    require(fm.applyRebuild().success && ImGui::GetIO().Fonts == atlas, "discarded build applied");
+}
+
+void testBackgroundNeedsThreadLocalContext() {
+    FontManager fm;
+    setup(fm);
+    fm.setBackgroundRebuild(true);
+#if IMGUI_VERSION_NUM >= 19200 || !defined(GImGui)
+    require(!fm.canRebuildInBackground(), "background rebuild without a thread-local GImGui");
+#else
+    require(fm.canRebuildInBackground(), "background rebuild not available");
+#endif
+}
+
+} // namespace
+
+int main() {
+    ImGui::CreateContext();
+    testNothingPending();
+    testApply();
+    testMarkDirtyWhilePending();
+    testDiscard();
+    testBackgroundNeedsThreadLocalContext();
+    ImGui::DestroyContext();
+    std::cout << "Font background rebuild tests passed\n";
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <chrono>
+#include <iostream>
+
+#include "imguix/core/window/FramePacer.hpp"
+
+using namespace ImGuiX;
+using namespace std::chrono_literals;
+using Clock = FramePacer::clock;
+
+int main() {
+    const Clock::time_point t0 = Clock::now();
+
+    // Continuous at 50 FPS: due once per 20 ms interval.
+    {
+        FramePacer pacer;
+        pacer.setTargetFps(50);
+        if (!pacer.isDue(t0)) {
+            std::cerr << "first frame not due\n";
+            return 1;
+        }
+        pacer.finish(t0);
+        if (pacer.isDue(t0 + 19ms) || !pacer.isDue(t0 + 20ms)) {
+            std::cerr << "continuous interval not respected\n";
+            return 1;
+        }
+        if (pacer.nextTime() != t0 + 20ms) {
+            std::cerr << "nextTime does not match the interval\n";
+            return 1;
+        }
+
+        // Slightly late frame keeps the cadence.
+        pacer.finish(t0 + 25ms);
+        if (pacer.nextTime() != t0 + 40ms) {
+            std::cerr << "cadence lost after a late frame\n";
+            return 1;
+        }
+
+        // Far behind: no burst of catch-up frames.
+        pacer.finish(t0 + 200ms);
+        if (pacer.nextTime() != t0 + 220ms) {
+            std::cerr << "burst scheduled after a stall\n";
+            return 1;
+        }
+
+        // Unlimited: due again right away.
+        pacer.setTargetFps(0);
+        pacer.finish(t0 + 300ms);
+        if (pacer.targetFps() != 0 || !pacer.isDue(t0 + 300ms)) {
+            std::cerr << "unlimited frame rate not due\n";
+            return 1;
+        }
+    }
+
+    // On demand: IMGUIX_REDRAW_FRAMES frames after input, then idle.
+    {
+        FramePacer pacer;
+        pacer.setTargetFps(0);
+        pacer.setMode(RedrawMode::OnDemand);
+        Clock::time_point now = t0;
+        int rendered = 0;
+        while (pacer.isDue(now) && rendered < 100) {
+            pacer.finish(now);
+            ++rendered;
+            now += 1ms;
+        }
+        if (rendered != IMGUIX_REDRAW_FRAMES) {
+            std::cerr << "expected " << IMGUIX_REDRAW_FRAMES
+                      << " frames after the mode switch, got " << rendered << '\n';
+            return 1;
+        }
+        if (pacer.pendingFrames() != 0 || pacer.nextTime() != Clock::time_point::max()) {
+            std::cerr << "idle on-demand pacer still schedules frames\n";
+            return 1;
+        }
+
+        pacer.markInput();
+        if (!pacer.isDue(now) || pacer.nextTime() == Clock::time_point::max()) {
+            std::cerr << "input does not make a frame due\n";
+            return 1;
+        }
+
+        // Extra finish() calls never drive the counter negative.
+        for (int i = 0; i < IMGUIX_REDRAW_FRAMES + 5; ++i) pacer.finish(now);
+        if (pacer.pendingFrames() != 0 || pacer.isDue(now)) {
+            std::cerr << "owed frames went negative\n";
+            return 1;
+        }
+    }
+
+    // On demand with a limit: owed frames still wait for the interval.
+    {
+        FramePacer pacer;
+        pacer.setTargetFps(10);
+        pacer.setMode(RedrawMode::OnDemand);
+        pacer.finish(t0);
+        if (pacer.isDue(t0 + 50ms) || !pacer.isDue(t0 + 100ms)) {
+            std::cerr << "on-demand frames ignore the target FPS\n";
+            return 1;
+        }
+    }
+
+    std::cout << "frame pacer tests passed\n";
+    return 0;
+}
@@ -0,0 +1,113 @@
+#define IMGUIX_ENABLE_PROFILER 1
+#define IMGUIX_PROFILER_HISTORY 100
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "imguix/core/profiler/FrameProfiler.hpp"
+
+using namespace ImGuiX::Profiling;
+
+namespace demo {
+    struct PanelController {};
+}
+
+static bool near(float a, float b) { return std::fabs(a - b) < 1e-3f; }
+
+int main() {
+    FrameProfiler& prof = FrameProfiler::instance();
+
+    // Same text at a different address maps to the same stage.
+    const std::string copy = "draw";
+    const std::size_t draw = prof.stageId("draw");
+    if (prof.stageId(copy.c_str()) != draw || prof.stageId("draw") != draw) {
+        std::cerr << "stage ids are not stable\n";
+        return 1;
+    }
+
+    // Frames 1..150 ms; only the last 100 (51..150) stay in the history.
+    for (int i = 1; i <= 150; ++i) {
+        prof.beginFrame();
+        prof.add(draw, std::chrono::milliseconds(i));
+        prof.add(draw, std::chrono::milliseconds(0));
+        prof.endFrame();
+    }
+    if (prof.frameCount() != 150 || prof.historySize() != 100) {
+        std::cerr << "history size mismatch\n";
+        return 1;
+    }
+
+    std::vector<float> hist;
+    prof.history(draw, hist);
+    if (hist.size() != 100 || !near(hist.front(), 51.0f) || !near(hist.back(), 150.0f)) {
+        std::cerr << "history not ordered oldest first\n";
+        return 1;
+    }
+
+    const StageStats s = prof.stats(draw);
+    if (!near(s.last_ms, 150.0f) || !near(s.p50_ms, 100.0f) || !near(s.p95_ms, 145.0f)
+        || !near(s.p99_ms, 149.0f) || !near(s.max_ms, 150.0f) || !near(s.avg_ms, 100.5f)) {
+        std::cerr << "percentiles mismatch: p50=" << s.p50_ms << " p95=" << s.p95_ms
+                  << " p99=" << s.p99_ms << "\n";
+        return 1;
+    }
+
+    // Scoped timers accumulate into the current frame only.
+    prof.reset();
+    prof.beginFrame();
+    for (int i = 0; i < 3; ++i) {
+        IMGUIX_PROFILE_SCOPE("loop");
+    }
+    { IMGUIX_PROFILE_SCOPE_DYNAMIC(copy.c_str()); }
+    IMGUIX_PROFILE_FRAME_END();
+    if (prof.stageCount() != 3 || std::string(prof.stageName(2)) != "loop") {
+        std::cerr << "scoped stage not registered\n";
+        return 1;
+    }
+    if (prof.stats(FrameProfiler::kFrameStage).last_ms < prof.stats(2).last_ms) {
+        std::cerr << "frame shorter than its stage\n";
+        return 1;
+    }
+
+    // A frame without begin is ignored.
+    prof.endFrame();
+    if (prof.frameCount() != 1) {
+        std::cerr << "unbalanced endFrame recorded a frame\n";
+        return 1;
+    }
+
+    // Type stages carry a readable name and are registered once per type.
+    const std::size_t panel = IMGUIX_PROFILE_TYPE_STAGE(demo::PanelController);
+    if (prof.stageId(typeid(demo::PanelController)) != panel
+        || std::string(prof.stageName(panel)) != "demo::PanelController") {
+        std::cerr << "type stage not demangled: " << prof.stageName(panel) << "\n";
+        return 1;
+    }
+
+    // Idle waits are reported by their stage but left out of the frame.
+    prof.reset();
+    prof.beginFrame();
+    {
+        IMGUIX_PROFILE_IDLE_SCOPE("wait");
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    }
+    { IMGUIX_PROFILE_SCOPE_ID(panel); }
+    prof.endFrame();
+    const std::size_t wait = prof.stageId("wait");
+    if (prof.stats(wait).last_ms < 30.0f) {
+        std::cerr << "idle stage not recorded\n";
+        return 1;
+    }
+    if (prof.stats(FrameProfiler::kFrameStage).last_ms >= 30.0f) {
+        std::cerr << "idle wait counted in the frame: "
+                  << prof.stats(FrameProfiler::kFrameStage).last_ms << " ms\n";
+        return 1;
+    }
+
+    std::cout << "Frame profiler tests passed\n";
+    return 0;
+}
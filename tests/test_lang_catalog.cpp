@@ -0,0 +1,89 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <imguix/core/i18n.hpp>
+
+using namespace ImGuiX::I18N;
+namespace fs = std::filesystem;
+
+static void writeFile(const fs::path& path, const std::string& text) {
+    fs::create_directories(path.parent_path());
+    std::ofstream f(path, std::ios::binary);
+    f << text;
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_lang_catalog_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    writeFile(dir / "en" / "ui.json", R"({ "Hello": "Hello", "Only.En": "fallback", "Files.one": "{} file", "Files.other": "{} files" })");
+    writeFile(dir / "ru" / "ui.json", R"({ // comment
+        "Hello": "Привет", "Files.one": "{} файл", "Files.few": "{} файла", "Files.many": "{} файлов" })");
+    writeFile(dir / "ru" / "About.md", "# О программе");
+
+    auto catalog = std::make_shared<LangCatalog>(dir.u8string(), "en");
+    LangStore a(catalog);
+    LangStore b(catalog);
+
+    // Views share the catalog's storage instead of copying it.
+    if (&a.text("Hello") != &b.text("Hello") || a.text("Hello") != "Hello") {
+        std::cerr << "views do not share the default table\n";
+        return 1;
+    }
+
+    a.set_language("ru");
+    if (a.text("Hello") != "Привет" || b.text("Hello") != "Hello") {
+        std::cerr << "language switch leaked between views\n";
+        return 1;
+    }
+    if (a.text("Only.En") != "fallback" || a.text("Missing") != "##null") {
+        std::cerr << "fallback chain broken\n";
+        return 1;
+    }
+    b.set_language("ru");
+    if (&a.text("Hello") != &b.text("Hello")) {
+        std::cerr << "language table was loaded twice\n";
+        return 1;
+    }
+    if (a.textf_plural("Files", 3, 3) != "3 файла" || std::string(a.label("Hello")) != "Привет##Hello") {
+        std::cerr << "plural or label lookup broken\n";
+        return 1;
+    }
+    if (a.doc("About") != "# О программе" || LangStore(catalog).doc("About") != "") {
+        std::cerr << "markdown lookup broken\n";
+        return 1;
+    }
+
+    // Concurrent first requests of a language resolve to one table.
+    std::vector<std::shared_ptr<const LangTable>> tables(8);
+    {
+        auto fresh = std::make_shared<LangCatalog>(dir.u8string(), "en");
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < tables.size(); ++i) {
+            threads.emplace_back([&, i] { tables[i] = fresh->table("ru"); });
+        }
+        for (auto& t : threads) t.join();
+    }
+    for (const auto& t : tables) {
+        if (t != tables[0] || t->size() != 4) {
+            std::cerr << "concurrent table loads disagree\n";
+            return 1;
+        }
+    }
+
+    // Views keep the catalog alive after the owner releases it.
+    std::weak_ptr<LangCatalog> weak = catalog;
+    catalog.reset();
+    if (weak.expired() || a.text("Hello") != "Привет") {
+        std::cerr << "view does not own its catalog\n";
+        return 1;
+    }
+
+    fs::remove_all(dir, ec);
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <imguix/core/i18n.hpp>
+
+using namespace ImGuiX::I18N;
+namespace fs = std::filesystem;
+
+static void writeFile(const fs::path& path, const std::string& text) {
+    fs::create_directories(path.parent_path());
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f << text;
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_lang_catalog_binary_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+
+    std::string big = "{";
+    for (int i = 0; i < 20000; ++i) {
+        if (i) big += ",";
+        big += "\"Key." + std::to_string(i) + "\":\"Value " + std::to_string(i) + "\"";
+    }
+    big += "}";
+    writeFile(dir / "en" / "a.json", big);
+    writeFile(dir / "en" / "b.json", R"({ "Key.0": "shadowed", "Polyglot": { "en": "Hi", "de": "Hallo" } })");
+    const std::string cache = (dir / "cache").u8string();
+    const fs::path bin = LangCatalog::catalog_path(cache, "en");
+    const fs::path shipped = LangCatalog::catalog_path(dir.u8string(), "en");
+
+    // First run parses JSON and writes the compiled catalog into the cache only.
+    {
+        auto catalog = std::make_shared<LangCatalog>(dir.u8string(), "en", cache);
+        const auto& table = *catalog->default_table();
+        if (table.is_mapped() || table.size() != 20001 || !fs::exists(bin)) {
+            std::cerr << "first run did not compile the catalog\n";
+            return 1;
+        }
+        if (fs::exists(shipped)) {
+            std::cerr << "catalog written into the resource directory\n";
+            return 1;
+        }
+        if (*table.find("Key.0") != "Value 0" || *table.find("Polyglot") != "Hi") {
+            std::cerr << "merge order changed\n";
+            return 1;
+        }
+    }
+
+    // Second run maps the file and answers lookups from it.
+    {
+        LangStore store(std::make_shared<LangCatalog>(dir.u8string(), "en", cache));
+        if (!store.catalog()->default_table()->is_mapped()) {
+            std::cerr << "compiled catalog was not mapped\n";
+            return 1;
+        }
+        const std::string_view v = store.text_view("Key.19999");
+        if (v != "Value 19999" || v.data()[v.size()] != '\0' || store.text("Key.5") != "Value 5") {
+            std::cerr << "mapped lookup failed\n";
+            return 1;
+        }
+        if (store.text_view("Key.") != "##null" || store.text("Missing") != "##null") {
+            std::cerr << "missing key lookup failed\n";
+            return 1;
+        }
+    }
+
+    // Editing a source invalidates the compiled file.
+    writeFile(dir / "en" / "b.json", R"({ "Polyglot": { "en": "Hello there" } })");
+    {
+        LangCatalog catalog(dir.u8string(), "en", cache);
+        if (catalog.default_table()->is_mapped() || *catalog.default_table()->find("Polyglot") != "Hello there") {
+            std::cerr << "stale catalog was used\n";
+            return 1;
+        }
+    }
+
+    // A catalog shipped without JSON sources is used as is; a corrupt one is ignored.
+    if (!LangCatalog::compile(dir.u8string(), "en")) {
+        std::cerr << "compile failed\n";
+        return 1;
+    }
+    fs::remove_all(dir / "en", ec);
+    fs::remove_all(cache, ec);
+    {
+        LangCatalog catalog(dir.u8string(), "en", cache);
+        if (!catalog.default_table()->is_mapped() || *catalog.default_table()->find("Key.7") != "Value 7") {
+            std::cerr << "shipped catalog was not used\n";
+            return 1;
+        }
+    }
+    {
+        std::fstream f(shipped, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(24);
+        const char junk[8] = {'\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f', '\x7f'};
+        f.write(junk, sizeof(junk));
+    }
+    {
+        LangCatalog catalog(dir.u8string(), "en", cache);
+        if (catalog.default_table()->size() != 0) {
+            std::cerr << "corrupt catalog was accepted\n";
+            return 1;
+        }
+    }
+
+    fs::remove_all(dir, ec);
+    return 0;
+}
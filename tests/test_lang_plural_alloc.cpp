@@ -0,0 +1,94 @@
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <imguix/core/i18n.hpp>
+
+using namespace ImGuiX::I18N;
+namespace fs = std::filesystem;
+
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Count global heap allocations to verify warm lookups are heap-free.
+static std::atomic<long> g_allocs{0};
+
+void* operator new(std::size_t size) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static void writeFile(const fs::path& path, const std::string& text) {
+    fs::create_directories(path.parent_path());
+    std::ofstream f(path, std::ios::binary);
+    f << text;
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_lang_plural_alloc_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    writeFile(dir / "en" / "ui.json", R"({ "Files.one": "{} file", "Files.other": "{} files", "Plain": "plain",
+        "Only.En.one": "one en", "Only.En.other": "many en" })");
+    writeFile(dir / "ru" / "ui.json", R"({ "Files.one": "{} файл", "Files.few": "{} файла", "Files.many": "{} файлов",
+        "Plain": "просто" })");
+
+    LangStore store(std::make_shared<LangCatalog>(dir.u8string(), "en"));
+    store.set_language("ru");
+
+    struct Case { const char* key; long long n; const char* expected; };
+    const Case cases[] = {
+        {"Files", 1, "{} файл"}, {"Files", 3, "{} файла"}, {"Files", 11, "{} файлов"},
+        {"Files", 21, "{} файл"}, {"Only.En", 1, "one en"}, {"Plain", 2, "просто"},
+        {"Missing", 1, "##null"},
+    };
+    for (const auto& c : cases) {
+        if (store.text_plural(c.key, c.n) != c.expected) {
+            std::cerr << "text_plural(" << c.key << ", " << c.n << ") = "
+                      << store.text_plural(c.key, c.n) << "\n";
+            return 1;
+        }
+    }
+    if (store.plural_category(3) != PluralCategory::Few || store.plural_suffix(3) != "few") {
+        std::cerr << "plural category mismatch\n";
+        return 1;
+    }
+    (void)store.label("Plain");
+    (void)store.label("Missing");
+
+    // Warm lookups do not touch the heap.
+    const long before = g_allocs.load();
+    for (int frame = 0; frame < 1000; ++frame) {
+        for (const auto& c : cases) (void)store.text_plural(c.key, c.n + frame * 100);
+        (void)store.label("Plain");
+        (void)store.label("Missing");
+        (void)store.plural_category(frame);
+    }
+    const long allocs = g_allocs.load() - before;
+    if (allocs != 0) {
+        std::cerr << "warm lookups allocated " << allocs << " times\n";
+        return 1;
+    }
+
+    // Missing label keys reuse one pooled copy across language switches.
+    for (int i = 0; i < 100; ++i) {
+        store.set_language(i % 2 ? "ru" : "en");
+        if (std::string(store.label("Missing")) != "##null##Missing") {
+            std::cerr << "label of missing key changed\n";
+            return 1;
+        }
+    }
+
+    fs::remove_all(dir, ec);
+    return 0;
+}
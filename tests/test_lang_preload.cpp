@@ -0,0 +1,92 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <imguix/core/i18n.hpp>
+
+using namespace ImGuiX::I18N;
+namespace fs = std::filesystem;
+
+static void writeLanguage(const fs::path& dir, const std::string& lang, int keys) {
+    fs::create_directories(dir / lang);
+    std::ofstream f(dir / lang / "ui.json", std::ios::binary);
+    f << "{";
+    for (int i = 0; i < keys; ++i) {
+        f << (i ? "," : "") << "\"Key." << i << "\":\"" << lang << " " << i << "\"";
+    }
+    f << "}";
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_lang_preload_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    const std::vector<std::string> langs = {"en", "ru", "de", "fr", "es"};
+    for (const auto& lang : langs) writeLanguage(dir, lang, 20000);
+
+    {
+        auto catalog = std::make_shared<LangCatalog>(dir.u8string(), "en");
+        LangStore store(catalog);
+
+        // Async switch: the current language stays until the table is ready.
+        store.set_language_async("ru");
+        if (store.language() != "en" || store.pending_language() != "ru") {
+            std::cerr << "async switch applied too early\n";
+            return 1;
+        }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (!store.poll_language()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                std::cerr << "async switch never completed\n";
+                return 1;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (store.language() != "ru" || store.text("Key.7") != "ru 7" || !store.pending_language().empty()) {
+            std::cerr << "async switch produced wrong strings\n";
+            return 1;
+        }
+
+        // Parallel warm-up shares loads with preload() and table().
+        catalog->preload_all({"de", "fr", "es"});
+        auto fr = catalog->preload("fr");
+        auto de = catalog->table("de"); // waits for the load in flight
+        auto es = catalog->preload("es").get();
+        if (fr.get() != catalog->table("fr") || de != catalog->try_table("de") ||
+            es != catalog->try_table("es") || !store.is_language_ready("es")) {
+            std::cerr << "preloaded tables disagree\n";
+            return 1;
+        }
+        store.set_language("de");
+        if (store.text("Key.19999") != "de 19999") {
+            std::cerr << "preloaded language has wrong strings\n";
+            return 1;
+        }
+        // A synchronous switch cancels a pending async one.
+        store.set_language_async("fr");
+        store.set_language("en");
+        if (store.poll_language() || store.language() != "en") {
+            std::cerr << "stale async switch was applied\n";
+            return 1;
+        }
+    }
+
+    // Destroying a catalog with loads in flight waits for them.
+    {
+        auto catalog = std::make_shared<LangCatalog>(dir.u8string(), "en");
+        catalog->preload_all({"ru", "de", "fr", "es"});
+    }
+
+    if (!LangCatalog::configured_preload_languages().empty()) {
+        std::cerr << "unexpected configured preload languages\n";
+        return 1;
+    }
+
+    fs::remove_all(dir, ec);
+    return 0;
+}
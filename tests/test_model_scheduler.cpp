@@ -0,0 +1,172 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "imguix/core/pubsub.hpp"
+#include "imguix/core/resource/ResourceRegistry.hpp"
+#include "imguix/core/application/ApplicationContext.hpp"
+#include "imguix/core/model/Model.hpp"
+#include "imguix/core/model/ModelScheduler.hpp"
+
+using namespace ImGuiX;
+using namespace std::chrono_literals;
+
+struct ResultEvent : Pubsub::Event {
+    int value{};
+    explicit ResultEvent(int v) : value(v) {}
+    std::type_index type() const override { return typeid(ResultEvent); }
+    const char* name() const override { return "ResultEvent"; }
+    IMGUIX_CLONEABLE_EVENT(ResultEvent)
+};
+
+/// Minimal context: models only need the event bus and registry.
+class TestContext : public ApplicationContext {
+public:
+    void close() override {}
+    bool isClosing() const override { return false; }
+    const std::string& name() const override { return m_name; }
+    Pubsub::EventBus& eventBus() override { return m_bus; }
+    ResourceRegistry& registry() override { return m_registry; }
+
+protected:
+    WindowInstance& createWindowImpl(WindowFactory) override { throw std::logic_error("unused"); }
+    Model& createModelImpl(ModelFactory) override { throw std::logic_error("unused"); }
+
+private:
+    Pubsub::EventBus m_bus;
+    ResourceRegistry m_registry;
+    std::string m_name{"test"};
+};
+
+class SlowModel : public Model {
+public:
+    SlowModel(ApplicationContext& app, int value) : Model(app), m_value(value) {}
+
+    void process(Pubsub::SyncNotifier& sync) override {
+        thread_id = std::this_thread::get_id();
+        deferred = sync.isDeferred();
+        std::this_thread::sleep_for(20ms);
+        sync.notify(ResultEvent{m_value});
+    }
+
+    std::thread::id thread_id;
+    bool deferred{false};
+
+private:
+    int m_value;
+};
+
+/// Spans several frames; the scheduler must not wait for it.
+class LongModel : public Model {
+public:
+    using Model::Model;
+
+    void process(Pubsub::SyncNotifier& sync) override {
+        calls.fetch_add(1);
+        std::this_thread::sleep_for(80ms);
+        sync.notify(ResultEvent{100});
+    }
+
+    std::atomic<int> calls{0};
+};
+
+int main() {
+    TestContext app;
+    auto& bus = app.eventBus();
+
+    std::vector<int> results;
+    Pubsub::EventMediator med(bus);
+    med.subscribe<ResultEvent>([&](const ResultEvent& e) { results.push_back(e.value); });
+
+    std::vector<std::unique_ptr<Model>> models;
+    for (int i = 0; i < 4; ++i) models.emplace_back(std::make_unique<SlowModel>(app, i));
+    models[0]->setExecution({ModelAffinity::UiThread, 0});
+    models[1]->setExecution({ModelAffinity::AnyWorker, 0});
+    models[2]->setExecution({ModelAffinity::AnyWorker, 0});
+    models[3]->setExecution({ModelAffinity::PinnedWorker, 1});
+
+    ModelScheduler scheduler;
+
+    // Without workers everything runs inline with synchronous delivery.
+    scheduler.run(models, bus);
+    if (results.size() != 4) { std::cerr << "inline run did not dispatch synchronously\n"; return 1; }
+    results.clear();
+
+    scheduler.setWorkerCount(3);
+    const auto start = std::chrono::steady_clock::now();
+    scheduler.run(models, bus);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto ui_id = std::this_thread::get_id();
+    auto* ui_model = static_cast<SlowModel*>(models[0].get());
+    auto* pinned = static_cast<SlowModel*>(models[3].get());
+    if (ui_model->thread_id != ui_id || ui_model->deferred) {
+        std::cerr << "UI-thread model ran elsewhere\n";
+        return 1;
+    }
+    if (pinned->thread_id == ui_id || !pinned->deferred) {
+        std::cerr << "pinned model ran on the UI thread\n";
+        return 1;
+    }
+    // UI model (20ms) runs first, the three worker models overlap afterwards.
+    if (elapsed > 70ms) {
+        std::cerr << "worker models did not run in parallel\n";
+        return 1;
+    }
+    if (results != std::vector<int>{0}) {
+        std::cerr << "worker outputs must be queued, not dispatched inline\n";
+        return 1;
+    }
+    bus.process();
+    if (results.size() != 4) {
+        std::cerr << "queued worker outputs lost\n";
+        return 1;
+    }
+
+    const auto stats = scheduler.stats();
+    if (stats.size() != 4 || stats[3].runs != 2 || stats[3].worker != 1
+        || stats[0].worker != ModelStats::kUiThread || stats[1].last < 15ms) {
+        std::cerr << "model stats mismatch\n";
+        return 1;
+    }
+
+    // Detached model: run() returns without it, and it is not queued again
+    // while the previous call is still running.
+    std::vector<std::unique_ptr<Model>> detached_models;
+    detached_models.emplace_back(std::make_unique<LongModel>(app));
+    auto* long_model = static_cast<LongModel*>(detached_models.back().get());
+    long_model->setExecution({ModelAffinity::AnyWorker, 0, true});
+    results.clear();
+
+    const auto detached_start = std::chrono::steady_clock::now();
+    scheduler.run(detached_models, bus);
+    scheduler.run(detached_models, bus);
+    scheduler.run(detached_models, bus);
+    if (std::chrono::steady_clock::now() - detached_start > 40ms) {
+        std::cerr << "frame waited for a detached model\n";
+        return 1;
+    }
+    results.clear();
+    const auto deadline = std::chrono::steady_clock::now() + 2s;
+    while (results.empty() && std::chrono::steady_clock::now() < deadline) {
+        bus.process();
+        std::this_thread::sleep_for(5ms);
+    }
+    if (results != std::vector<int>{100} || long_model->calls.load() != 1) {
+        std::cerr << "detached model ran twice or its output was lost\n";
+        return 1;
+    }
+    scheduler.run(detached_models, bus);
+    std::this_thread::sleep_for(120ms);
+    if (long_model->calls.load() != 2) {
+        std::cerr << "detached model not rescheduled after finishing\n";
+        return 1;
+    }
+
+    std::cout << "Model scheduler tests passed\n";
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "imguix/core/options/OptionsStore.hpp"
+
+using namespace ImGuiX;
+namespace fs = std::filesystem;
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_option_key_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    const std::string file = (dir / "options.json").u8string();
+
+    OptionsStore store(file, 0.0);
+    auto scale = store.key<float>("ui.scale", 1.5f);
+    auto theme = store.view().key<std::string>("theme", "classic");
+    auto count = store.control().key<std::int32_t>("count");
+
+    if (scale.get() != 1.5f || theme.get() != "classic" || count.get() != 0) {
+        std::cerr << "missing keys must yield defaults\n";
+        return 1;
+    }
+
+    // Cached value is returned by reference until the key changes.
+    const std::string* before = &theme.get();
+    store.setStr("theme", "dark");
+    if (theme.get() != "dark" || &theme.get() != before) {
+        std::cerr << "write did not invalidate the cached value\n";
+        return 1;
+    }
+
+    // Writes to other keys leave the cache alone; coercion matches getXOr.
+    store.setStr("count", "42");
+    store.setI32("other", 7);
+    if (count.get() != 42) {
+        std::cerr << "string value not coerced\n";
+        return 1;
+    }
+    store.erase("count");
+    if (count.get() != 0) {
+        std::cerr << "erase did not restore the default\n";
+        return 1;
+    }
+
+    // Handles created later share the same change counter.
+    store.setF32("ui.scale", 2.0f);
+    auto scale2 = store.key<float>("ui.scale", 1.0f);
+    if (scale.get() != 2.0f || scale2.get() != 2.0f) {
+        std::cerr << "handles disagree\n";
+        return 1;
+    }
+
+    // Each thread reads through its own copy while the key is written.
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([key = scale]() {
+            for (int i = 0; i < 20000; ++i) {
+                float v = key.get();
+                if (v < 2.0f || v > 3.0f) std::abort();
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i) store.setF32("ui.scale", 2.0f + (i % 2));
+    for (auto& th : readers) th.join();
+
+    // Reloading from disk invalidates every bound key.
+    store.setStr("theme", "saved");
+    store.saveNow();
+    store.setStr("theme", "unsaved");
+    (void)theme.get();
+    store.load();
+    if (theme.get() != "saved") {
+        std::cerr << "load did not invalidate cached values\n";
+        return 1;
+    }
+
+    OptionKey<bool> unbound;
+    if (unbound || unbound.get()) {
+        std::cerr << "unbound handle misbehaves\n";
+        return 1;
+    }
+
+    fs::remove_all(dir, ec);
+    std::cout << "Option key tests passed\n";
+    return 0;
+}
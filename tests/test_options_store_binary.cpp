@@ -0,0 +1,112 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include "imguix/core/options/OptionsStore.hpp"
+
+using namespace ImGuiX;
+namespace fs = std::filesystem;
+
+static void fill(OptionsStore& store) {
+    std::vector<std::string> recent;
+    for (int i = 0; i < 2000; ++i) recent.push_back("/projects/item_" + std::to_string(i));
+    store.setStrVec("recent", recent);
+    for (int i = 0; i < 2000; ++i) store.setF64("layout." + std::to_string(i), i * 0.5);
+    store.setBool("flag", true);
+    store.setI64("big", 1ll << 40);
+    store.setVersion(3);
+}
+
+static bool same(const OptionsStore& a, const OptionsStore& b) {
+    return a.getStrVecOr("recent", {}) == b.getStrVecOr("recent", {})
+        && a.getF64Or("layout.1999", 0.0) == b.getF64Or("layout.1999", -1.0)
+        && a.getBoolOr("flag", false) == b.getBoolOr("flag", false)
+        && a.getI64Or("big", 0) == b.getI64Or("big", 0)
+        && a.version() == b.version();
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_options_binary_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir, ec);
+    const std::string json_file = (dir / "options.json").u8string();
+    const std::string bin_file = (dir / "options.msgpack").u8string();
+
+    // Legacy JSON file written by an older build.
+    {
+        OptionsStore legacy(json_file, 0.0);
+        if (legacy.fileFormat() != OptionsFileFormat::Json) {
+            std::cerr << "json extension not detected\n";
+            return 1;
+        }
+        fill(legacy);
+        legacy.saveNow();
+    }
+
+    // A binary store migrates from the JSON file with the same stem.
+    OptionsStore reference(json_file, 0.0);
+    {
+        OptionsStore bin(bin_file, 0.0);
+        if (bin.fileFormat() != OptionsFileFormat::MessagePack || !same(bin, reference)) {
+            std::cerr << "migration from JSON failed\n";
+            return 1;
+        }
+        bin.update();
+        bin.flush();
+    }
+    if (!fs::exists(bin_file) || fs::file_size(bin_file) >= fs::file_size(json_file)) {
+        std::cerr << "binary file missing or not smaller than JSON\n";
+        return 1;
+    }
+
+    // Binary round trip, and binary wins over the JSON file once it exists.
+    {
+        OptionsStore bin(bin_file, 0.0);
+        if (!same(bin, reference)) {
+            std::cerr << "binary round trip mismatch\n";
+            return 1;
+        }
+        bin.setStr("only_binary", "yes");
+        bin.saveNow();
+    }
+    {
+        OptionsStore bin(bin_file, 0.0);
+        if (bin.getStrOr("only_binary", "") != "yes") {
+            std::cerr << "binary file not preferred over legacy JSON\n";
+            return 1;
+        }
+
+        // Export to JSON and import into a CBOR store selected explicitly.
+        const std::string exported = (dir / "export.json").u8string();
+        if (!bin.exportJson(exported)) {
+            std::cerr << "export failed\n";
+            return 1;
+        }
+        OptionsStore cbor((dir / "opts.dat").u8string(), 0.0, OptionsFileFormat::Cbor);
+        auto key = cbor.key<std::string>("only_binary");
+        (void)key.get();
+        if (!cbor.importJson(exported) || key.get() != "yes" || !same(cbor, reference)) {
+            std::cerr << "import did not replace values\n";
+            return 1;
+        }
+        cbor.flush();
+        OptionsStore cbor2((dir / "opts.dat").u8string(), 0.0, OptionsFileFormat::Cbor);
+        if (!same(cbor2, reference)) {
+            std::cerr << "CBOR round trip mismatch\n";
+            return 1;
+        }
+        if (cbor.importJson((dir / "missing.json").u8string())) {
+            std::cerr << "import of a missing file succeeded\n";
+            return 1;
+        }
+    }
+
+    fs::remove_all(dir, ec);
+    std::cout << "OptionsStore binary format tests passed\n";
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <nlohmann/json.hpp>
+#include "imguix/core/options/OptionsStore.hpp"
+
+using namespace ImGuiX;
+namespace fs = std::filesystem;
+
+static nlohmann::json readJson(const fs::path& path) {
+    std::ifstream f(path, std::ios::binary);
+    nlohmann::json j;
+    if (f.good()) f >> j;
+    return j;
+}
+
+static std::uintmax_t fileSize(const fs::path& path) {
+    std::error_code ec;
+    auto size = fs::file_size(path, ec);
+    return ec ? 0 : size;
+}
+
+static int countLines(const fs::path& path) {
+    std::ifstream f(path, std::ios::binary);
+    int lines = 0;
+    std::string line;
+    while (std::getline(f, line)) ++lines;
+    return lines;
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_options_journal_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    const fs::path file = dir / "options.json";
+    const fs::path journal = dir / "options.json.journal";
+
+    {
+        OptionsStore store(file.u8string(), 0.0);
+        store.setJournalEnabled(true);
+        for (int i = 0; i < 100; ++i) store.setStr("bulk" + std::to_string(i), std::string(64, 'x'));
+        store.flush(); // first save after enabling is a snapshot
+        const auto snapshot_size = fileSize(file);
+        if (snapshot_size == 0 || fs::exists(journal)) {
+            std::cerr << "first save should write a snapshot\n";
+            return 1;
+        }
+
+        store.setI32("a", 1);
+        store.setI32("a", 2); // coalesced into one record
+        store.setBool("b", true);
+        store.erase("bulk0");
+        store.flush();
+        if (fileSize(file) != snapshot_size) {
+            std::cerr << "journaled save rewrote the snapshot\n";
+            return 1;
+        }
+        const auto journal_size = fileSize(journal);
+        if (journal_size == 0 || journal_size > 80 || countLines(journal) != 3) {
+            std::cerr << "unexpected journal size " << journal_size << "\n";
+            return 1;
+        }
+    }
+
+    // Replay restores values on top of the snapshot, including erasures.
+    {
+        OptionsStore store(file.u8string(), 0.0);
+        store.load();
+        if (store.getI32Or("a", 0) != 2 || !store.getBoolOr("b", false) || store.has("bulk0")
+                || !store.has("bulk1")) {
+            std::cerr << "journal replay lost changes\n";
+            return 1;
+        }
+    }
+
+    // A torn last record is ignored.
+    {
+        std::ofstream jf(journal, std::ios::binary | std::ios::app);
+        jf << "{\"k\":\"a\",\"v\":3}\n{\"k\":\"a\",\"v\":";
+    }
+    {
+        OptionsStore store(file.u8string(), 0.0);
+        store.load();
+        if (store.getI32Or("a", 0) != 3) {
+            std::cerr << "torn journal record was not handled\n";
+            return 1;
+        }
+        // The replayed journal is compacted by the next save.
+        store.setJournalEnabled(true);
+        store.setI32("c", 7);
+        store.flush();
+        if (fs::exists(journal) || readJson(file).value("a", 0) != 3) {
+            std::cerr << "replayed journal was not compacted\n";
+            return 1;
+        }
+    }
+
+    // Growing past the limit compacts into a snapshot.
+    {
+        OptionsStore store(file.u8string(), 0.0);
+        store.load();
+        store.setJournalEnabled(true);
+        store.flush();
+        const std::string big(1024, 'y');
+        bool compacted = false;
+        for (int i = 0; i < 400 && !compacted; ++i) {
+            store.setStr("big", big + std::to_string(i));
+            store.flush();
+            if (fileSize(journal) > IMGUIX_OPTIONS_JOURNAL_MAX_BYTES + 2048) {
+                std::cerr << "journal exceeded its limit\n";
+                return 1;
+            }
+            compacted = i > 0 && !fs::exists(journal);
+        }
+        if (!compacted || readJson(file)["big"].get<std::string>().rfind(big, 0) != 0) {
+            std::cerr << "journal was never compacted\n";
+            return 1;
+        }
+    }
+
+    // A journal left behind by a crash after the snapshot rename is stale.
+    {
+        const fs::path stale = dir / "stale.journal";
+        {
+            OptionsStore store(file.u8string(), 0.0);
+            store.load();
+            store.setJournalEnabled(true);
+            store.setI32("a", 0);
+            store.flush(); // snapshot
+            store.setI32("a", 1);
+            store.flush(); // journal record
+            fs::copy_file(journal, stale, fs::copy_options::overwrite_existing, ec);
+            store.setI32("a", 5);
+            store.saveNow();
+        }
+        if (fs::exists(journal) || !fs::exists(stale)) {
+            std::cerr << "snapshot did not drop the journal\n";
+            return 1;
+        }
+        fs::rename(stale, journal, ec);
+        OptionsStore store(file.u8string(), 0.0);
+        store.load();
+        if (store.getI32Or("a", 0) != 5) {
+            std::cerr << "stale journal overrode a newer snapshot\n";
+            return 1;
+        }
+    }
+
+    fs::remove_all(dir, ec);
+    return 0;
+}
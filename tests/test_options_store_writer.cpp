@@ -0,0 +1,100 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include "imguix/core/options/OptionsStore.hpp"
+
+using namespace ImGuiX;
+namespace fs = std::filesystem;
+
+static nlohmann::json readJson(const fs::path& path) {
+    std::ifstream f(path, std::ios::binary);
+    nlohmann::json j;
+    if (f.good()) f >> j;
+    return j;
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "imguix_options_writer_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    const fs::path file = dir / "options.json";
+
+    {
+        OptionsStore store(file.u8string(), 0.0);
+        store.setFsyncPolicy(OptionsFsyncPolicy::OnFlush);
+
+        // Setters on other threads keep working while saves are queued.
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 4; ++t) {
+            writers.emplace_back([&store, t] {
+                for (int i = 0; i < 200; ++i) {
+                    store.setI32("w" + std::to_string(t), i);
+                    if (i % 10 == 0) store.update();
+                }
+            });
+        }
+        for (auto& th : writers) th.join();
+
+        store.update();
+        store.flush();
+        const auto j = readJson(file);
+        for (int t = 0; t < 4; ++t) {
+            const std::string key = "w" + std::to_string(t);
+            if (!j.contains(key) || j[key].get<int>() != 199) {
+                std::cerr << "flush did not persist the latest value of " << key << "\n";
+                return 1;
+            }
+        }
+        if (fs::exists(file.string() + ".tmp")) {
+            std::cerr << "temporary file left behind\n";
+            return 1;
+        }
+
+        // saveNow() returns after the file is written.
+        store.setStr("name", "saved");
+        store.saveNow();
+        if (readJson(file).value("name", "") != "saved") {
+            std::cerr << "saveNow did not write synchronously\n";
+            return 1;
+        }
+
+        // A queued save finishes before the store is destroyed.
+        store.setBool("last", true);
+        store.update();
+    }
+    if (!readJson(file).value("last", false)) {
+        std::cerr << "pending save dropped on destruction\n";
+        return 1;
+    }
+
+    OptionsStore reloaded(file.u8string(), 0.0);
+    if (reloaded.getI32Or("w2", -1) != 199 || reloaded.getStrOr("name", "") != "saved") {
+        std::cerr << "reloaded values mismatch\n";
+        return 1;
+    }
+
+    // A failed write is retried by the next flush().
+    {
+        const fs::path blocked = dir / "blocked.json";
+        fs::create_directories(blocked, ec); // rename onto a directory fails
+        OptionsStore store(blocked.u8string(), 0.0);
+        store.setStr("retry", "kept");
+        store.flush();
+        fs::remove_all(blocked, ec);
+        store.flush();
+        const auto j = readJson(blocked);
+        if (!j.is_object() || j.value("retry", "") != "kept") {
+            std::cerr << "flush did not retry a failed write\n";
+            return 1;
+        }
+    }
+
+    fs::remove_all(dir, ec);
+    std::cout << "OptionsStore writer tests passed\n";
+    return 0;
+}
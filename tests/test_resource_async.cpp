@@ -0,0 +1,159 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include "imguix/core/resource/ResourceRegistry.hpp"
+
+using namespace ImGuiX;
+using namespace std::chrono_literals;
+
+struct Atlas { int glyphs = 0; };
+struct Cache { int entries = 0; };
+struct Database { int rows = 0; };
+struct Broken {};
+struct NeedsBroken {};
+struct Unused {};
+struct Missing {};
+struct Orphan {};
+struct OrphanChild {};
+struct Late {};
+struct NeedsLate {};
+
+int main() {
+    ResourceRegistry registry;
+    registry.setAsyncWorkerCount(2);
+
+    std::atomic<int> running{0};
+    std::atomic<int> overlap{0};
+    auto slow = [&](auto value) {
+        if (++running > 1) overlap = 1;
+        std::this_thread::sleep_for(50ms);
+        --running;
+        return value;
+    };
+
+    auto atlas = registry.registerResourceAsync<Atlas>([&] {
+        return slow(std::make_shared<Atlas>(Atlas{42}));
+    });
+    auto db = registry.registerResourceAsync<Database>([&] {
+        return slow(std::make_shared<Database>(Database{7}));
+    });
+    auto cache = registry.registerResourceAsync<Cache, Atlas, Database>([&] {
+        // Dependencies are ready when the creator starts.
+        auto& a = registry.getResource<Atlas>();
+        auto& d = registry.getResource<Database>();
+        return std::make_shared<Cache>(Cache{a.glyphs + d.rows});
+    });
+
+    // Not ready yet: tryGetResource reports nullopt instead of throwing.
+    if (registry.tryGetResource<Cache>()) {
+        std::cerr << "cache visible before construction finished\n";
+        return 1;
+    }
+    if (registry.registerResourceAsync<Atlas>().get()) {
+        std::cerr << "duplicate async registration accepted\n";
+        return 1;
+    }
+
+    // getResource waits for the pending resource.
+    if (registry.getResource<Cache>().entries != 49) {
+        std::cerr << "dependent resource built with wrong inputs\n";
+        return 1;
+    }
+    if (!atlas.get() || !db.get() || !cache.get()) {
+        std::cerr << "futures not fulfilled\n";
+        return 1;
+    }
+    if (!overlap) {
+        std::cerr << "independent resources were not built in parallel\n";
+        return 1;
+    }
+
+    // A failing creator fails its dependents.
+    auto broken = registry.registerResourceAsync<Broken>([]() -> std::shared_ptr<Broken> {
+        throw std::runtime_error("boom");
+    });
+    auto needs = registry.registerResourceAsync<NeedsBroken, Broken>();
+    registry.waitAll();
+    bool broken_threw = false;
+    bool needs_threw = false;
+    try { broken.get(); } catch (const std::runtime_error&) { broken_threw = true; }
+    try { needs.get(); } catch (const std::runtime_error&) { needs_threw = true; }
+    if (!broken_threw || !needs_threw || registry.tryGetResource<NeedsBroken>()) {
+        std::cerr << "failure did not propagate to dependents\n";
+        return 1;
+    }
+
+    // Synchronous registration does not hold the lock while creating.
+    std::thread reg([&] {
+        registry.registerResource<Unused>([&] {
+            std::this_thread::sleep_for(300ms);
+            return std::make_shared<Unused>();
+        });
+    });
+    std::this_thread::sleep_for(5ms);
+    const auto start = std::chrono::steady_clock::now();
+    (void)registry.getResource<Atlas>();
+    if (std::chrono::steady_clock::now() - start > 150ms) {
+        std::cerr << "unrelated lookup blocked by a creator\n";
+        reg.join();
+        return 1;
+    }
+    reg.join();
+
+    // A dependency that is never registered fails its dependents instead of
+    // parking them forever.
+    {
+        ResourceRegistry orphans;
+        orphans.setAsyncWorkerCount(2);
+        auto orphan = orphans.registerResourceAsync<Orphan, Missing>();
+        auto child = orphans.registerResourceAsync<OrphanChild, Orphan>();
+        orphans.waitAll();
+        bool orphan_threw = false;
+        bool child_threw = false;
+        try { orphan.get(); } catch (const std::runtime_error&) { orphan_threw = true; }
+        try { child.get(); } catch (const std::runtime_error&) { child_threw = true; }
+        if (!orphan_threw || !child_threw) {
+            std::cerr << "undeclared dependency did not fail its dependents\n";
+            return 1;
+        }
+    }
+    {
+        ResourceRegistry orphans;
+        orphans.setAsyncWorkerCount(1);
+        (void)orphans.registerResourceAsync<Orphan, Missing>();
+        bool threw = false;
+        try { (void)orphans.getResource<Orphan>(); } catch (const std::runtime_error&) { threw = true; }
+        if (!threw) {
+            std::cerr << "getResource returned a resource with an undeclared dependency\n";
+            return 1;
+        }
+    }
+
+    // A dependency registered later is still waited for.
+    {
+        ResourceRegistry late;
+        late.setAsyncWorkerCount(1);
+        auto needs_late = late.registerResourceAsync<NeedsLate, Late>();
+        late.registerResource<Late>();
+        late.waitAll();
+        if (!needs_late.get()) {
+            std::cerr << "dependency registered later was not picked up\n";
+            return 1;
+        }
+    }
+
+    // Inline mode runs creators on the registering thread.
+    ResourceRegistry inline_registry;
+    inline_registry.setAsyncWorkerCount(0);
+    auto f = inline_registry.registerResourceAsync<Atlas>();
+    if (f.wait_for(0s) != std::future_status::ready || !inline_registry.tryGetResource<Atlas>()) {
+        std::cerr << "inline async registration not completed\n";
+        return 1;
+    }
+
+    std::cout << "Resource async tests passed\n";
+    return 0;
+}
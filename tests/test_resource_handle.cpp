@@ -0,0 +1,82 @@
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "imguix/core/resource/ResourceRegistry.hpp"
+
+using namespace ImGuiX;
+
+struct Clock {
+    int ticks = 0;
+};
+
+struct Late {
+    int value = 3;
+};
+
+int main() {
+    ResourceRegistry registry;
+    registry.registerResource<Clock>();
+
+    auto clock = registry.handle<Clock>();
+    clock->ticks = 5;
+    if (&clock.get() != &registry.getResource<Clock>() || registry.getResource<Clock>().ticks != 5) {
+        std::cerr << "handle resolved to a different instance\n";
+        return 1;
+    }
+
+    // Not registered yet: tryGet() keeps retrying, get() throws.
+    auto late = registry.handle<Late>();
+    if (late.tryGet() != nullptr) {
+        std::cerr << "unregistered resource resolved\n";
+        return 1;
+    }
+    bool threw = false;
+    try {
+        (void)late.get();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    if (!threw) {
+        std::cerr << "get() on an unregistered resource did not throw\n";
+        return 1;
+    }
+    registry.registerResource<Late>();
+    if (!late.tryGet() || late->value != 3) {
+        std::cerr << "handle did not pick up a later registration\n";
+        return 1;
+    }
+
+    // Copies are independent and usable from other threads.
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([h = clock]() mutable {
+            for (int i = 0; i < 10000; ++i) {
+                if (h.get().ticks != 5) std::abort();
+            }
+        });
+    }
+    for (auto& th : readers) th.join();
+
+    // clearAll() invalidates cached pointers.
+    registry.clearAll();
+    if (clock.tryGet() != nullptr) {
+        std::cerr << "handle survived clearAll\n";
+        return 1;
+    }
+    registry.registerResource<Clock>();
+    if (clock->ticks != 0) {
+        std::cerr << "handle did not re-resolve after clearAll\n";
+        return 1;
+    }
+
+    ResourceHandle<Clock> unbound;
+    if (unbound || unbound.tryGet() != nullptr) {
+        std::cerr << "unbound handle resolved\n";
+        return 1;
+    }
+
+    std::cout << "Resource handle tests passed\n";
+    return 0;
+}